@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [x] Renderer: Instanced rectangles (ImGuiBackendFlags_RendererHasRectInstances, opt-in with io.ConfigDrawListRectInstances) [Desktop OpenGL 3.3+ and OpenGL ES 3.0+ only!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +24,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Added support for compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), with 16-bit fixed point positions and 16-bit normalized UVs.
+//  2026-10-18: OpenGL: Desktop GL 3.3+ and GL ES 3.0+: Added support for ImGuiBackendFlags_RendererHasRectInstances, drawing ImDrawCmd::RectCount rectangles with glDrawArraysInstanced().
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
 //  2025-06-11: OpenGL: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplOpenGL3_CreateFontsTexture() and ImGui_ImplOpenGL3_DestroyFontsTexture().
@@ -217,6 +220,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have glVertexAttribDivisor() and glDrawArraysInstanced()
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -242,11 +250,18 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
-    unsigned int    VboHandle, ElementsHandle;
+    GLuint          ShaderRectsHandle;       // Program used for ImDrawCmd::RectCount > 0 (when HasRectInstances)
+    GLint           AttribLocationRectsTex;
+    GLint           AttribLocationRectsProjMtx;
+    GLuint          AttribLocationRectPos;   // Instance attributes location
+    GLuint          AttribLocationRectUV;
+    GLuint          AttribLocationRectColor;
+    unsigned int    VboHandle, ElementsHandle, RectsHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
+    bool            HasRectInstances;
     bool            UseBufferSubData;
     ImVector<char>  TempBuffer;
 
@@ -388,6 +403,13 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     strcpy(bd->GlslVersionString, glsl_version);
     strcat(bd->GlslVersionString, "\n");
 
+    // Rect instances are expanded to two triangles by the vertex shader using gl_VertexID, which requires GLSL 1.30 or GLSL ES 3.00.
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    int glsl_version_num = 130;
+    sscanf(bd->GlslVersionString, "#version %d", &glsl_version_num);
+    bd->HasRectInstances = (bd->GlVersion >= 330 || bd->GlProfileIsES3) && glsl_version_num >= 130; // ImGuiBackendFlags_RendererHasRectInstances is set in NewFrame() when opted-in with io.ConfigDrawListRectInstances.
+#endif
+
     // Make an arbitrary GL call (we don't actually need the result)
     // IF YOU GET A CRASH HERE: it probably means the OpenGL function loader didn't do its job. Let us know!
     GLint current_texture;
@@ -421,7 +443,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasRectInstances);
     IM_DELETE(bd);
 
 #ifdef IMGUI_IMPL_OPENGL_LOADER_IMGL3W
@@ -439,9 +461,17 @@ void    ImGui_ImplOpenGL3_NewFrame()
     if (!bd->ShaderHandle)
         if (!ImGui_ImplOpenGL3_CreateDeviceObjects())
             IM_ASSERT(0 && "ImGui_ImplOpenGL3_CreateDeviceObjects() failed!");
+
+    // We can honor the ImDrawCmd::RectCount field, drawing ImDrawList::RectBuffer[] with instancing.
+    // Only enabled when requested by the application, as rect instances bypass vertex post-processing (e.g. ShadeVertsTransformPos()).
+    ImGuiIO& io = ImGui::GetIO();
+    if (bd->HasRectInstances && io.ConfigDrawListRectInstances)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasRectInstances;
+    else
+        io.BackendFlags &= ~ImGuiBackendFlags_RendererHasRectInstances;
 }
 
-static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
+static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object, GLuint vertex_array_object_rects)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
@@ -490,9 +520,42 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+
+    // Setup program and instance attributes for ImDrawRectInstance, in their own vertex array object.
+    // Attribute pointers are set for each command as we cannot rely on glDrawArraysInstancedBaseInstance() being available.
+    (void)vertex_array_object_rects;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    if (bd->HasRectInstances)
+    {
+        glUseProgram(bd->ShaderRectsHandle);
+        glUniform1i(bd->AttribLocationRectsTex, 0);
+        glUniformMatrix4fv(bd->AttribLocationRectsProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+        glBindVertexArray(vertex_array_object_rects);
+        GL_CALL(glEnableVertexAttribArray(bd->AttribLocationRectPos));
+        GL_CALL(glEnableVertexAttribArray(bd->AttribLocationRectUV));
+        GL_CALL(glEnableVertexAttribArray(bd->AttribLocationRectColor));
+        GL_CALL(glVertexAttribDivisor(bd->AttribLocationRectPos, 1));
+        GL_CALL(glVertexAttribDivisor(bd->AttribLocationRectUV, 1));
+        GL_CALL(glVertexAttribDivisor(bd->AttribLocationRectColor, 1));
+    }
+#endif
+
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Compact ImDrawVert positions are 16-bit fixed point: fold the conversion to pixels into the projection matrix.
+    const float pos_scale = 1.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+    const float vtx_projection[4][4] =
+    {
+        { ortho_projection[0][0] * pos_scale, 0.0f, 0.0f, 0.0f },
+        { 0.0f, ortho_projection[1][1] * pos_scale, 0.0f, 0.0f },
+        { ortho_projection[2][0], ortho_projection[2][1], ortho_projection[2][2], ortho_projection[2][3] },
+        { ortho_projection[3][0], ortho_projection[3][1], ortho_projection[3][2], ortho_projection[3][3] },
+    };
+    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &vtx_projection[0][0]);
+#else
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+#endif
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
@@ -510,8 +573,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
@@ -580,10 +648,16 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
     GLuint vertex_array_object = 0;
+    GLuint vertex_array_object_rects = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
 #endif
-    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    bool rects_state = false; // Set when ShaderRectsHandle and vertex_array_object_rects are bound
+    if (bd->HasRectInstances)
+        GL_CALL(glGenVertexArrays(1, &vertex_array_object_rects));
+#endif
+    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object, vertex_array_object_rects);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -622,16 +696,33 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
             GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
         }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+        if (draw_list->RectBuffer.Size > 0)
+        {
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->RectsHandle));
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)draw_list->RectBuffer.Size * (int)sizeof(ImDrawRectInstance), (const GLvoid*)draw_list->RectBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+        }
+#endif
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+            if (rects_state && (pcmd->UserCallback != nullptr || pcmd->RectCount == 0))
+            {
+                // Switch back to regular program and vertex array object
+                glUseProgram(bd->ShaderHandle);
+                glBindVertexArray(vertex_array_object);
+                rects_state = false;
+            }
+#endif
             if (pcmd->UserCallback != nullptr)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object, vertex_array_object_rects);
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -648,6 +739,26 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
                 // Bind texture, Draw
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+                if (pcmd->RectCount > 0)
+                {
+                    // Draw rect instances: 6 vertices each, expanded by the vertex shader
+                    if (!rects_state)
+                    {
+                        glUseProgram(bd->ShaderRectsHandle);
+                        glBindVertexArray(vertex_array_object_rects);
+                        rects_state = true;
+                    }
+                    const size_t rect_offset = pcmd->RectOffset * sizeof(ImDrawRectInstance);
+                    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->RectsHandle));
+                    GL_CALL(glVertexAttribPointer(bd->AttribLocationRectPos,   4, GL_FLOAT,         GL_FALSE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, PosMin))));
+                    GL_CALL(glVertexAttribPointer(bd->AttribLocationRectUV,    4, GL_FLOAT,         GL_FALSE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, UvMin))));
+                    GL_CALL(glVertexAttribPointer(bd->AttribLocationRectColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, Col))));
+                    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+                    GL_CALL(glDrawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)pcmd->RectCount));
+                    continue;
+                }
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
@@ -656,12 +767,24 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+        if (rects_state)
+        {
+            glUseProgram(bd->ShaderHandle);
+            glBindVertexArray(vertex_array_object);
+            rects_state = false;
+        }
+#endif
     }
 
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    if (vertex_array_object_rects != 0)
+        GL_CALL(glDeleteVertexArrays(1, &vertex_array_object_rects));
+#endif
 
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
@@ -905,6 +1028,40 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Rect instances: each instance is expanded to 6 vertices (0,1,2)+(0,2,3) with the same triangulation as ImDrawList::PrimRectUV().
+    const GLchar* vertex_shader_rects_glsl_130 =
+        "uniform mat4 ProjMtx;\n"
+        "in vec4 RectPos;\n"
+        "in vec4 RectUV;\n"
+        "in vec4 RectColor;\n"
+        "out vec2 Frag_UV;\n"
+        "out vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    int corner = (gl_VertexID < 3) ? gl_VertexID : (gl_VertexID == 3) ? 0 : gl_VertexID - 2;\n"
+        "    vec2 t = vec2((corner == 1 || corner == 2) ? 1.0 : 0.0, (corner >= 2) ? 1.0 : 0.0);\n"
+        "    Frag_UV = mix(RectUV.xy, RectUV.zw, t);\n"
+        "    Frag_Color = RectColor;\n"
+        "    gl_Position = ProjMtx * vec4(mix(RectPos.xy, RectPos.zw, t),0,1);\n"
+        "}\n";
+
+    const GLchar* vertex_shader_rects_glsl_300_es =
+        "precision highp float;\n"
+        "layout (location = 0) in vec4 RectPos;\n"
+        "layout (location = 1) in vec4 RectUV;\n"
+        "layout (location = 2) in vec4 RectColor;\n"
+        "uniform mat4 ProjMtx;\n"
+        "out vec2 Frag_UV;\n"
+        "out vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    int corner = (gl_VertexID < 3) ? gl_VertexID : (gl_VertexID == 3) ? 0 : gl_VertexID - 2;\n"
+        "    vec2 t = vec2((corner == 1 || corner == 2) ? 1.0 : 0.0, (corner >= 2) ? 1.0 : 0.0);\n"
+        "    Frag_UV = mix(RectUV.xy, RectUV.zw, t);\n"
+        "    Frag_Color = RectColor;\n"
+        "    gl_Position = ProjMtx * vec4(mix(RectPos.xy, RectPos.zw, t),0,1);\n"
+        "}\n";
+
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
         "    precision mediump float;\n"
@@ -950,6 +1107,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = nullptr;
+    const GLchar* vertex_shader_rects = (glsl_version == 300) ? vertex_shader_rects_glsl_300_es : vertex_shader_rects_glsl_130;
     const GLchar* fragment_shader = nullptr;
     if (glsl_version < 130)
     {
@@ -1000,7 +1158,6 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
     glDeleteShader(vert_handle);
-    glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
@@ -1008,9 +1165,41 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+    // Create and link rect instances program, sharing the fragment shader
+    if (bd->HasRectInstances)
+    {
+        const GLchar* vertex_shader_rects_with_version[2] = { bd->GlslVersionString, vertex_shader_rects };
+        GLuint vert_rects_handle;
+        GL_CALL(vert_rects_handle = glCreateShader(GL_VERTEX_SHADER));
+        glShaderSource(vert_rects_handle, 2, vertex_shader_rects_with_version, nullptr);
+        glCompileShader(vert_rects_handle);
+        if (!CheckShader(vert_rects_handle, "rects vertex shader"))
+            return false;
+
+        bd->ShaderRectsHandle = glCreateProgram();
+        glAttachShader(bd->ShaderRectsHandle, vert_rects_handle);
+        glAttachShader(bd->ShaderRectsHandle, frag_handle);
+        glLinkProgram(bd->ShaderRectsHandle);
+        if (!CheckProgram(bd->ShaderRectsHandle, "rects shader program"))
+            return false;
+
+        glDetachShader(bd->ShaderRectsHandle, vert_rects_handle);
+        glDetachShader(bd->ShaderRectsHandle, frag_handle);
+        glDeleteShader(vert_rects_handle);
+
+        bd->AttribLocationRectsTex = glGetUniformLocation(bd->ShaderRectsHandle, "Texture");
+        bd->AttribLocationRectsProjMtx = glGetUniformLocation(bd->ShaderRectsHandle, "ProjMtx");
+        bd->AttribLocationRectPos = (GLuint)glGetAttribLocation(bd->ShaderRectsHandle, "RectPos");
+        bd->AttribLocationRectUV = (GLuint)glGetAttribLocation(bd->ShaderRectsHandle, "RectUV");
+        bd->AttribLocationRectColor = (GLuint)glGetAttribLocation(bd->ShaderRectsHandle, "RectColor");
+    }
+    glDeleteShader(frag_handle);
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
+    if (bd->HasRectInstances)
+        glGenBuffers(1, &bd->RectsHandle);
 
     // Restore modified GL state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -1030,7 +1219,9 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    if (bd->RectsHandle)    { glDeleteBuffers(1, &bd->RectsHandle); bd->RectsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderRectsHandle) { glDeleteProgram(bd->ShaderRectsHandle); bd->ShaderRectsHandle = 0; }
 
     // Destroy all textures
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
@@ -138,7 +138,18 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // We wait for events until io.NextWakeupDelay, so an idle UI doesn't run the main loop at full frame rate.
+        // Call glfwPollEvents() instead if your application needs to render continuously (e.g. a game, or to read gamepad inputs).
+#ifdef __EMSCRIPTEN__
         glfwPollEvents();
+#else
+        if (io.NextWakeupDelay >= FLT_MAX)
+            glfwWaitEvents();
+        else if (io.NextWakeupDelay > 0.0f)
+            glfwWaitEventsTimeout(io.NextWakeupDelay);
+        else
+            glfwPollEvents();
+#endif
         if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0)
         {
             ImGui_ImplGlfw_Sleep(10);
@@ -0,0 +1,715 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, run fixed synthetic workloads headless with NO INPUTS, NO GRAPHICS OUTPUT, and report timings)
+// This is useful to catch performance regressions when upgrading dear imgui or changing build options.
+//
+// Build: 'make benchmark' (Makefile builds with -O2 -DNDEBUG)
+// Usage: example_null_benchmark [--frames N] [--warmup N] [--filter NAME] [--output FILE] [--baseline FILE] [--threshold PERCENT] [--alloc-break]
+// - Results are written as JSON Lines (one object per workload) to stdout or to the --output file. A summary is printed to stderr.
+// - Save results from a reference build, then run with '--baseline FILE' to compare median frame times.
+//   The exit code is 1 when any workload is slower than the baseline by more than --threshold percent (default: 10),
+//   and 2 when the baseline file can't be read. Workloads missing from the baseline are reported as warnings.
+// - Workloads marked as steady state (e.g. 'steady_state') must not allocate once warmed up: the exit code is 1 if they do.
+//   Run under a debugger with '--alloc-break' to break on the first allocation of their measured frames and inspect the callstack.
+// - Each workload runs in its own context. Times are measured from NewFrame() to Render() included.
+// - Each workload reports its own work unit (rows, bytes, windows, nodes, points...) and ns per unit.
+//   For 'hidden_windows_10k' the unit is the number of windows alive in the context: time per frame should not scale with it.
+// - Items per frame are counted with the Metrics/Debugger costs recorder (unavailable with IMGUI_DISABLE_DEBUG_TOOLS).
+
+#include "imgui.h"
+#include "imgui_internal.h" // For items count and opening demo sections
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Allocations counter
+//-----------------------------------------------------------------------------
+
+static int g_AllocCount = 0;
+
+static void* BenchmarkMemAlloc(size_t size, void* user_data)
+{
+    IM_UNUSED(user_data);
+    g_AllocCount++;
+    return malloc(size);
+}
+
+static void BenchmarkMemFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Workloads
+//-----------------------------------------------------------------------------
+
+// Each workload returns the number of work units it submitted this frame (see 'Unit' in g_Workloads[]),
+// or -1 to use the number of items counted by the costs recorder.
+
+// 100k rows table with clipper, scrolled to a different position every frame
+static int Workload_Table100k(int frame)
+{
+    const int ROWS_COUNT = 100000;
+    int rows_submitted = 0;
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Table", NULL, ImGuiWindowFlags_NoSavedSettings);
+    if (ImGui::BeginTable("table", 4, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(ROWS_COUNT);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++, rows_submitted++)
+            {
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%06d", row);
+                ImGui::TableNextColumn();
+                ImGui::Text("Item %d", row * 7);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", sinf((float)row));
+                ImGui::TableNextColumn();
+                ImGui::SmallButton("Edit");
+                ImGui::PopID();
+            }
+        ImGui::SetScrollY((float)((frame * 997) % ROWS_COUNT) * ImGui::GetTextLineHeightWithSpacing());
+        ImGui::EndTable();
+    }
+    ImGui::End();
+    return rows_submitted;
+}
+
+// 64 columns table with ~10k visible cells on a 4K display (stresses draw channels merging)
+static int Workload_Table64Columns(int frame)
+{
+    const int COLUMNS_COUNT = 64;
+    if (frame == 0)
+        ImGui::GetIO().DisplaySize = ImVec2(3840, 2160); // Applied on next frame
+    int cells_submitted = 0;
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Table64", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(4.0f, 0.0f));
+    if (ImGui::BeginTable("table", COLUMNS_COUNT, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGuiListClipper clipper;
+        clipper.Begin(1000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                for (int column = 0; column < COLUMNS_COUNT; column++, cells_submitted++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", (row * column) % 1000);
+                }
+            }
+        ImGui::EndTable();
+    }
+    ImGui::PopStyleVar();
+    ImGui::End();
+    return cells_submitted;
+}
+
+// 1 MB of text in a single scrolling window
+static int Workload_Text1MB(int frame)
+{
+    static ImGuiTextBuffer text;
+    if (text.empty())
+        for (int line = 0; text.size() < 1024 * 1024; line++)
+            text.appendf("%06d: The quick brown fox jumps over the lazy dog. %d\n", line, line * 13);
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Text", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::TextUnformatted(text.begin(), text.end());
+    ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)(frame % 100) / 100.0f);
+    ImGui::End();
+    return text.size();
+}
+
+// 100k lines of text in a single window, scrolled to the middle (coarse clipping of large text blocks)
+static int Workload_Text100kLines(int frame)
+{
+    IM_UNUSED(frame);
+    const int LINES_COUNT = 100000;
+    static ImGuiTextBuffer text;
+    if (text.empty())
+        for (int line = 0; line < LINES_COUNT; line++)
+            text.appendf("%06d: The quick brown fox jumps over the lazy dog.\n", line);
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Text100k", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::TextUnformatted(text.begin(), text.end());
+    ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+    ImGui::End();
+    return LINES_COUNT;
+}
+
+// 1000 small windows with a few widgets each
+static int Workload_Windows1000(int frame)
+{
+    IM_UNUSED(frame);
+    const int WINDOWS_COUNT = 1000;
+    static float values[WINDOWS_COUNT] = {};
+    for (int n = 0; n < WINDOWS_COUNT; n++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Window %04d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)(n % 40) * 48.0f, (float)(n / 40) * 40.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(200.0f, 100.0f), ImGuiCond_Once);
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Hello from window %d", n);
+        ImGui::Button("Button");
+        ImGui::SliderFloat("Value", &values[n], 0.0f, 1.0f);
+        ImGui::End();
+    }
+    return WINDOWS_COUNT;
+}
+
+// 10 visible windows, with 10k hidden windows created on the first frame and never submitted again
+// (hidden windows stay in the recently active list until their buffers are compacted after io.ConfigMemoryCompactTimer seconds:
+// we use a short timer to measure the steady state during the default warmup frames)
+static int Workload_HiddenWindows10k(int frame)
+{
+    const int HIDDEN_WINDOWS_COUNT = 10000;
+    const int VISIBLE_WINDOWS_COUNT = 10;
+    char name[32];
+    ImGui::GetIO().ConfigMemoryCompactTimer = 0.1f;
+    if (frame == 0)
+        for (int n = 0; n < HIDDEN_WINDOWS_COUNT; n++)
+        {
+            snprintf(name, sizeof(name), "Hidden %05d", n);
+            ImGui::SetNextWindowPos(ImVec2((float)(n % 100) * 19.0f, (float)(n / 100) * 10.0f));
+            ImGui::SetNextWindowSize(ImVec2(100.0f, 60.0f));
+            ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+            ImGui::Text("Hidden");
+            ImGui::End();
+        }
+    for (int n = 0; n < VISIBLE_WINDOWS_COUNT; n++)
+    {
+        snprintf(name, sizeof(name), "Visible %d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)n * 150.0f, 100.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(140.0f, 100.0f), ImGuiCond_Once);
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Frame %d", frame);
+        ImGui::Button("Button");
+        ImGui::End();
+    }
+    return ImGui::GetCurrentContext()->Windows.Size;
+}
+
+// Deep trees, all nodes open
+// (depth is kept under 32 as tree stack data are tracked using a 32-bit mask per window, use more trees instead)
+static int Workload_TreeDeep(int frame)
+{
+    IM_UNUSED(frame);
+    const int TREES_COUNT = 35;
+    const int TREE_DEPTH = 30;
+    const int LEAVES_PER_NODE = 3;
+    int nodes_submitted = 0;
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Trees", NULL, ImGuiWindowFlags_NoSavedSettings);
+    for (int tree_n = 0; tree_n < TREES_COUNT; tree_n++)
+    {
+        int depth = 0;
+        for (; depth < TREE_DEPTH; depth++)
+        {
+            ImGui::SetNextItemOpen(true);
+            nodes_submitted++;
+            if (!ImGui::TreeNode((void*)(intptr_t)depth, "Tree %d Node %d", tree_n, depth))
+                break;
+            for (int leaf_n = 0; leaf_n < LEAVES_PER_NODE; leaf_n++, nodes_submitted++)
+                ImGui::TreeNodeEx((void*)(intptr_t)(TREE_DEPTH + leaf_n), ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "Leaf %d", leaf_n);
+        }
+        while (depth-- > 0)
+            ImGui::TreePop();
+    }
+    ImGui::End();
+    return nodes_submitted;
+}
+
+// Demo window, with its top-level sections open
+static int Workload_Demo(int frame)
+{
+    if (frame == 1)
+        if (ImGuiWindow* window = ImGui::FindWindowByName("Dear ImGui Demo"))
+        {
+            const char* headers[] = { "Help", "Configuration", "Window options", "Widgets", "Layout & Scrolling", "Popups & Modal windows", "Tables & Columns", "Inputs & Focus" };
+            for (const char* header : headers)
+                window->StateStorage.SetInt(ImHashStr(header, 0, window->ID), 1);
+        }
+    ImGui::ShowDemoWindow(NULL);
+    return -1;
+}
+
+// Demo window, Metrics window and a scrolling table: once warmed up, repeating frames should not allocate
+static int Workload_SteadyState(int frame)
+{
+    Workload_Demo(frame);
+    ImGui::ShowMetricsWindow();
+    Workload_Table100k(frame);
+    return -1;
+}
+
+// Plots with 1M points
+static int Workload_Plot1M(int frame)
+{
+    const int POINTS_COUNT = 1000000;
+    static float* values = NULL;
+    if (values == NULL)
+    {
+        values = (float*)malloc(sizeof(float) * POINTS_COUNT);
+        for (int n = 0; n < POINTS_COUNT; n++)
+            values[n] = sinf((float)n * 0.001f) + cosf((float)n * 0.017f) * 0.25f;
+    }
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Plot", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PlotLines("Lines", values, POINTS_COUNT, frame % 1000, NULL, -1.5f, 1.5f, ImVec2(-1.0f, 400.0f));
+    ImGui::PlotHistogram("Histogram", values, POINTS_COUNT, frame % 1000, NULL, -1.5f, 1.5f, ImVec2(-1.0f, 400.0f));
+    ImGui::End();
+    return POINTS_COUNT * 2;
+}
+
+// Active multi-line text input with a large buffer
+static int Workload_InputTextMultiline(int frame)
+{
+    static char* buf = NULL;
+    static int len = 0;
+    const int BUF_SIZE = 512 * 1024;
+    if (buf == NULL)
+    {
+        buf = (char*)malloc(BUF_SIZE);
+        for (int line = 0; len < BUF_SIZE / 2; line++)
+            len += snprintf(buf + len, (size_t)(BUF_SIZE - len), "Line %06d: Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n", line);
+    }
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("InputText", NULL, ImGuiWindowFlags_NoSavedSettings);
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", buf, BUF_SIZE, ImVec2(-1.0f, -1.0f));
+    ImGui::End();
+    return len;
+}
+
+// AddPolyline(): 16 lines of 4000 points with various thicknesses, with or without anti-aliasing
+static int Workload_Polyline(int frame, bool anti_aliased)
+{
+    IM_UNUSED(frame);
+    const int LINES_COUNT = 16;
+    const int POINTS_COUNT = 4000;
+    static ImVec2* points = NULL;
+    if (points == NULL)
+    {
+        points = (ImVec2*)malloc(sizeof(ImVec2) * LINES_COUNT * POINTS_COUNT);
+        for (int line_n = 0; line_n < LINES_COUNT; line_n++)
+            for (int n = 0; n < POINTS_COUNT; n++)
+                points[line_n * POINTS_COUNT + n] = ImVec2(10.0f + n * 0.475f, 60.0f + line_n * 60.0f + sinf(n * 0.05f + line_n) * 25.0f);
+    }
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Polyline", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImDrawListFlags backup_flags = draw_list->Flags;
+    if (!anti_aliased)
+        draw_list->Flags &= ~(ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex);
+    const float thicknesses[] = { 1.0f, 2.5f, 4.0f, 1.5f };
+    for (int line_n = 0; line_n < LINES_COUNT; line_n++)
+        draw_list->AddPolyline(&points[line_n * POINTS_COUNT], POINTS_COUNT, IM_COL32(255, 200, 100, 255), (line_n & 4) ? ImDrawFlags_Closed : ImDrawFlags_None, thicknesses[line_n % IM_ARRAYSIZE(thicknesses)]);
+    draw_list->Flags = backup_flags;
+    ImGui::End();
+    return LINES_COUNT * POINTS_COUNT;
+}
+static int Workload_PolylineAA(int frame)       { return Workload_Polyline(frame, true); }
+static int Workload_PolylineNoAA(int frame)     { return Workload_Polyline(frame, false); }
+
+// AddConcavePolyFilled(): vector/map-like shapes. 50 stars (10 points), 50 convex circles (32 points, fast path) and 50 irregular outlines (256 points)
+static int Workload_ConcavePoly(int frame)
+{
+    IM_UNUSED(frame);
+    const int SHAPES_COUNT = 50;
+    const int STAR_POINTS = 10, CIRCLE_POINTS = 32, OUTLINE_POINTS = 256;
+    static ImVec2 star[STAR_POINTS], circle[CIRCLE_POINTS], outline[OUTLINE_POINTS];
+    if (outline[0].x == 0.0f)
+    {
+        for (int n = 0; n < STAR_POINTS; n++)
+        {
+            const float a = n * IM_PI * 2.0f / STAR_POINTS, r = (n & 1) ? 20.0f : 50.0f;
+            star[n] = ImVec2(cosf(a) * r, sinf(a) * r);
+        }
+        for (int n = 0; n < CIRCLE_POINTS; n++)
+        {
+            const float a = n * IM_PI * 2.0f / CIRCLE_POINTS, r = 50.0f;
+            circle[n] = ImVec2(cosf(a) * r, sinf(a) * r);
+        }
+        for (int n = 0; n < OUTLINE_POINTS; n++)
+        {
+            const float a = n * IM_PI * 2.0f / OUTLINE_POINTS, r = 40.0f + sinf(a * 7.0f) * 8.0f + sinf(a * 23.0f) * 4.0f;
+            outline[n] = ImVec2(cosf(a) * r, sinf(a) * r);
+        }
+    }
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("ConcavePoly", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    ImVec2 points[OUTLINE_POINTS];
+    for (int shape_n = 0; shape_n < SHAPES_COUNT * 3; shape_n++)
+    {
+        const ImVec2 center(60.0f + (shape_n % 25) * 74.0f, 60.0f + (shape_n / 25) * 84.0f);
+        const ImVec2* src = (shape_n % 3 == 0) ? star : (shape_n % 3 == 1) ? circle : outline;
+        const int points_count = (shape_n % 3 == 0) ? STAR_POINTS : (shape_n % 3 == 1) ? CIRCLE_POINTS : OUTLINE_POINTS;
+        for (int n = 0; n < points_count; n++)
+            points[n] = ImVec2(center.x + src[n].x, center.y + src[n].y);
+        draw_list->AddConcavePolyFilled(points, points_count, IM_COL32(100, 180, 255, 255));
+    }
+    ImGui::End();
+    return SHAPES_COUNT * (STAR_POINTS + CIRCLE_POINTS + OUTLINE_POINTS);
+}
+
+// 10k rects, 10k circles and 10k lines, submitted with the batch API or one call per primitive
+static int Workload_Primitives(int frame, bool batch)
+{
+    IM_UNUSED(frame);
+    const int PRIMS_COUNT = 10000;
+    static ImVec2* pos = NULL;
+    static ImU32* cols = NULL;
+    static float* radii = NULL;
+    if (pos == NULL)
+    {
+        pos = (ImVec2*)malloc(sizeof(ImVec2) * PRIMS_COUNT * 2);
+        cols = (ImU32*)malloc(sizeof(ImU32) * PRIMS_COUNT);
+        radii = (float*)malloc(sizeof(float) * PRIMS_COUNT);
+        for (int n = 0; n < PRIMS_COUNT; n++)
+        {
+            pos[n] = ImVec2(10.0f + (n % 100) * 19.0f, 10.0f + (n / 100) * 10.0f);
+            pos[PRIMS_COUNT + n] = ImVec2(pos[n].x + 8.0f + (n % 7), pos[n].y + 6.0f);
+            cols[n] = IM_COL32(n & 255, (n * 7) & 255, 200, 255);
+            radii[n] = 4.0f;
+        }
+    }
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Primitives", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    if (batch)
+    {
+        draw_list->AddRectFilledBatch(pos, pos + PRIMS_COUNT, cols, PRIMS_COUNT);
+        draw_list->AddCircleFilledBatch(pos, radii, cols, PRIMS_COUNT);
+        draw_list->AddLineBatch(pos, pos + PRIMS_COUNT, cols, PRIMS_COUNT);
+    }
+    else
+    {
+        for (int n = 0; n < PRIMS_COUNT; n++)
+            draw_list->AddRectFilled(pos[n], pos[PRIMS_COUNT + n], cols[n]);
+        for (int n = 0; n < PRIMS_COUNT; n++)
+            draw_list->AddCircleFilled(pos[n], radii[n], cols[n]);
+        for (int n = 0; n < PRIMS_COUNT; n++)
+            draw_list->AddLine(pos[n], pos[PRIMS_COUNT + n], cols[n]);
+    }
+    ImGui::End();
+    return PRIMS_COUNT * 3;
+}
+static int Workload_PrimitivesBatch(int frame)      { return Workload_Primitives(frame, true); }
+static int Workload_PrimitivesPerCall(int frame)    { return Workload_Primitives(frame, false); }
+
+struct Workload
+{
+    const char* Name;
+    const char* Unit;
+    int         (*Func)(int frame);
+    bool        RequireZeroAllocs;  // Fail if measured frames allocate
+};
+
+static const Workload g_Workloads[] =
+{
+    { "table_100k",           "rows",     Workload_Table100k,           false },
+    { "table_64_columns",     "cells",    Workload_Table64Columns,      false },
+    { "text_1mb",             "bytes",    Workload_Text1MB,             false },
+    { "text_100k_lines",      "lines",    Workload_Text100kLines,       false },
+    { "windows_1000",         "windows",  Workload_Windows1000,         false },
+    { "hidden_windows_10k",   "windows",  Workload_HiddenWindows10k,    false },
+    { "tree_deep",            "nodes",    Workload_TreeDeep,            false },
+    { "demo",                 "items",    Workload_Demo,                false },
+    { "steady_state",         "items",    Workload_SteadyState,         true },
+    { "plot_1m",              "points",   Workload_Plot1M,              false },
+    { "input_text_multiline", "bytes",    Workload_InputTextMultiline,  false },
+    { "polyline_aa",          "points",   Workload_PolylineAA,          false },
+    { "polyline_no_aa",       "points",   Workload_PolylineNoAA,        false },
+    { "concave_poly",         "points",   Workload_ConcavePoly,         false },
+    { "prims_batch",          "prims",    Workload_PrimitivesBatch,     false },
+    { "prims_per_call",       "prims",    Workload_PrimitivesPerCall,   false },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct WorkloadResult
+{
+    int         Frames;
+    double      NsMean, NsMin, NsP50, NsP90, NsP99, NsMax;
+    double      Units;              // Work units per frame (as returned by the workload)
+    int         Items;              // Items submitted in one frame
+    int         Vertices;           // Vertices/indices output by last frame
+    int         Indices;
+    double      Allocs;             // Allocations per frame
+};
+
+static int CompareDouble(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs;
+    const double b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static double Percentile(const double* sorted_values, int count, double percentile)
+{
+    int idx = (int)ceil(percentile / 100.0 * count) - 1; // Nearest-rank
+    return sorted_values[idx < 0 ? 0 : idx >= count ? count - 1 : idx];
+}
+
+static int RunFrame(const Workload& workload, int frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    int units = workload.Func(frame);
+    ImGui::Render();
+    return units;
+}
+
+// Null renderer: acknowledge texture requests (allocations made here are not counted)
+static void UpdateTextures()
+{
+    const int alloc_count_backup = g_AllocCount;
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->Status != ImTextureStatus_OK)
+            tex->SetStatus(ImTextureStatus_OK);
+    g_AllocCount = alloc_count_backup;
+}
+
+static void RunWorkload(const Workload& workload, int warmup_frames, int frames, bool alloc_break, WorkloadResult* result)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080); // Workloads may change it
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+    IM_UNUSED(alloc_break);
+
+    double* times = (double*)malloc(sizeof(double) * (size_t)frames);
+    int frame = 0;
+    for (int n = 0; n < warmup_frames; n++)
+    {
+        RunFrame(workload, frame++);
+        UpdateTextures();
+    }
+
+    const int alloc_count_begin = g_AllocCount;
+    double times_total = 0.0;
+    double units_total = 0.0;
+    for (int n = 0; n < frames; n++)
+    {
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+        ImGuiDebugAllocInfo* alloc_info = &ImGui::GetCurrentContext()->DebugAllocInfo;
+        alloc_info->DebugBreakInAlloc = alloc_break && workload.RequireZeroAllocs;
+#endif
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        units_total += RunFrame(workload, frame++);
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        times[n] = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+        times_total += times[n];
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+        alloc_info->DebugBreakInAlloc = false;
+#endif
+        UpdateTextures();
+    }
+    result->Allocs = (double)(g_AllocCount - alloc_count_begin) / frames;
+    result->Vertices = ImGui::GetDrawData()->TotalVtxCount;
+    result->Indices = ImGui::GetDrawData()->TotalIdxCount;
+
+    // Count items in one extra frame, as recording costs would skew timings
+    result->Items = 0;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    g.DebugCostsEnabled = true;
+    ImGui::NewFrame();
+    workload.Func(frame++);
+    for (ImGuiWindow* window : g.Windows)
+        result->Items += window->DebugCosts.ItemsCount;
+    ImGui::Render();
+    g.DebugCostsEnabled = false;
+#endif
+    result->Units = (units_total < 0.0) ? (double)result->Items : units_total / frames;
+
+    qsort(times, (size_t)frames, sizeof(double), CompareDouble);
+    result->Frames = frames;
+    result->NsMean = times_total / frames;
+    result->NsMin = times[0];
+    result->NsP50 = Percentile(times, frames, 50.0);
+    result->NsP90 = Percentile(times, frames, 90.0);
+    result->NsP99 = Percentile(times, frames, 99.0);
+    result->NsMax = times[frames - 1];
+    free(times);
+
+    ImGui::DestroyContext();
+}
+
+// Extract a number from one of our JSON lines. Not a general purpose JSON parser!
+static bool ParseJsonNumber(const char* line, const char* key, double* out_value)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* p = strstr(line, pattern);
+    return p != NULL && sscanf(p + strlen(pattern), "%lf", out_value) == 1;
+}
+
+// Find median frame time of a workload in baseline file contents (zero-terminated).
+static bool FindBaselineP50(const char* baseline_data, const char* workload_name, double* out_ns)
+{
+    char name_pattern[64];
+    snprintf(name_pattern, sizeof(name_pattern), "\"workload\":\"%s\"", workload_name);
+    const char* name = strstr(baseline_data, name_pattern);
+    if (name == NULL)
+        return false;
+    const char* line_begin = name;
+    while (line_begin > baseline_data && line_begin[-1] != '\n')
+        line_begin--;
+    const char* line_end = strchr(name, '\n');
+    char line[1024];
+    const size_t line_len = line_end ? (size_t)(line_end - line_begin) : strlen(line_begin);
+    if (line_len >= sizeof(line))
+        return false;
+    memcpy(line, line_begin, line_len);
+    line[line_len] = 0;
+    return ParseJsonNumber(line, "ns_per_frame_p50", out_ns);
+}
+
+int main(int argc, char** argv)
+{
+    int frames = 200;
+    int warmup_frames = 20;
+    const char* filter = NULL;
+    const char* output_filename = NULL;
+    const char* baseline_filename = NULL;
+    double threshold_percent = 10.0;
+    bool alloc_break = false;
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--frames") == 0 && has_value)             { frames = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--warmup") == 0 && has_value)        { warmup_frames = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--filter") == 0 && has_value)        { filter = argv[++n]; }
+        else if (strcmp(argv[n], "--output") == 0 && has_value)        { output_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--baseline") == 0 && has_value)      { baseline_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--threshold") == 0 && has_value)     { threshold_percent = atof(argv[++n]); }
+        else if (strcmp(argv[n], "--alloc-break") == 0)                { alloc_break = true; }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--filter NAME] [--output FILE] [--baseline FILE] [--threshold PERCENT] [--alloc-break]\n", argv[0]);
+            fprintf(stderr, "Workloads:");
+            for (const Workload& workload : g_Workloads)
+                fprintf(stderr, " %s", workload.Name);
+            fprintf(stderr, "\n");
+            return 2;
+        }
+    }
+    if (frames < 1)
+        frames = 1;
+    if (warmup_frames < 2)
+        warmup_frames = 2; // Some workloads create windows or open sections during their first frames
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(BenchmarkMemAlloc, BenchmarkMemFree, NULL);
+
+    // Load baseline once: a missing or invalid baseline is an error, so a regression check can't silently pass.
+    char* baseline_data = NULL;
+    if (baseline_filename != NULL)
+    {
+        baseline_data = (char*)ImFileLoadToMemory(baseline_filename, "rb", NULL, 1);
+        if (baseline_data == NULL || strstr(baseline_data, "\"workload\":") == NULL)
+        {
+            fprintf(stderr, "Error: cannot read benchmark results from baseline '%s'.\n", baseline_filename);
+            IM_FREE(baseline_data);
+            return 2;
+        }
+    }
+
+    FILE* output = stdout;
+    if (output_filename != NULL && (output = fopen(output_filename, "wt")) == NULL)
+    {
+        fprintf(stderr, "Error: cannot open '%s' for writing.\n", output_filename);
+        return 2;
+    }
+
+    fprintf(stderr, "Dear ImGui %s benchmark, %d frames per workload\n", IMGUI_VERSION, frames);
+    fprintf(stderr, "%-22s %10s %10s %10s %10s %8s %10s %10s %10s\n", "workload", "p50 ms", "p90 ms", "p99 ms", "units", "", "ns/unit", "vertices", "allocs");
+    int regressions_count = 0;
+    int alloc_failures_count = 0;
+    int baseline_missing_count = 0;
+    for (const Workload& workload : g_Workloads)
+    {
+        if (filter != NULL && strstr(workload.Name, filter) == NULL)
+            continue;
+        WorkloadResult r;
+        RunWorkload(workload, warmup_frames, frames, alloc_break, &r);
+        const double ns_per_unit = r.Units > 0.0 ? r.NsP50 / r.Units : 0.0;
+        fprintf(output, "{\"workload\":\"%s\",\"imgui_version\":\"%s\",\"frames\":%d,"
+            "\"ns_per_frame_mean\":%.0f,\"ns_per_frame_min\":%.0f,\"ns_per_frame_p50\":%.0f,\"ns_per_frame_p90\":%.0f,\"ns_per_frame_p99\":%.0f,\"ns_per_frame_max\":%.0f,"
+            "\"unit\":\"%s\",\"units_per_frame\":%.1f,\"ns_per_unit\":%.3f,"
+            "\"items_per_frame\":%d,\"vertices_per_frame\":%d,\"indices_per_frame\":%d,\"allocs_per_frame\":%.2f}\n",
+            workload.Name, IMGUI_VERSION, r.Frames,
+            r.NsMean, r.NsMin, r.NsP50, r.NsP90, r.NsP99, r.NsMax,
+            workload.Unit, r.Units, ns_per_unit,
+            r.Items, r.Vertices, r.Indices, r.Allocs);
+        fflush(output);
+        fprintf(stderr, "%-22s %10.3f %10.3f %10.3f %10.0f %-8s %10.3f %10d %10.2f", workload.Name, r.NsP50 / 1e6, r.NsP90 / 1e6, r.NsP99 / 1e6, r.Units, workload.Unit, ns_per_unit, r.Vertices, r.Allocs);
+
+        if (workload.RequireZeroAllocs && r.Allocs > 0.0)
+        {
+            fprintf(stderr, "  ALLOCATIONS (expected none)");
+            alloc_failures_count++;
+        }
+
+        double baseline_ns = 0.0;
+        if (baseline_data != NULL && FindBaselineP50(baseline_data, workload.Name, &baseline_ns) && baseline_ns > 0.0)
+        {
+            const double delta_percent = (r.NsP50 - baseline_ns) * 100.0 / baseline_ns;
+            const bool is_regression = (delta_percent > threshold_percent);
+            fprintf(stderr, "  %+6.1f%% vs baseline%s", delta_percent, is_regression ? " REGRESSION" : "");
+            if (is_regression)
+                regressions_count++;
+        }
+        else if (baseline_data != NULL)
+        {
+            fprintf(stderr, "  WARNING: not in baseline");
+            baseline_missing_count++;
+        }
+        fprintf(stderr, "\n");
+    }
+
+    if (output != stdout)
+        fclose(output);
+    if (baseline_data != NULL)
+    {
+        fprintf(stderr, "%d regression(s) above %.1f%% threshold.\n", regressions_count, threshold_percent);
+        if (baseline_missing_count > 0)
+            fprintf(stderr, "WARNING: %d workload(s) missing from baseline '%s', not compared.\n", baseline_missing_count, baseline_filename);
+        IM_FREE(baseline_data);
+    }
+    if (alloc_failures_count > 0)
+        fprintf(stderr, "%d steady state workload(s) allocated memory. Run with '--alloc-break' under a debugger to find the callstack.\n", alloc_failures_count);
+    return (regressions_count > 0 || alloc_failures_count > 0) ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+// dear imgui: "null" multi-threading stress test
+// (N threads each updating their own context, sharing one font atlas with a LockFunc, headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// This is useful to test IMGUI_USE_THREAD_LOCAL_CONTEXT and ImFontAtlas::LockFunc, ideally under ThreadSanitizer.
+//
+// Build: 'make stress_threads' (Makefile builds imgui with -DIMGUI_USE_THREAD_LOCAL_CONTEXT -pthread)
+//        'CXXFLAGS=-fsanitize=thread make stress_threads' to build with ThreadSanitizer.
+// Usage: example_null_stress_threads [THREADS] [CYCLES]
+// - Every frame submits text at varying sizes with glyphs missing from the atlas, so threads keep loading glyphs,
+//   adding baked sizes and growing the atlas texture concurrently.
+// - Between cycles the main thread updates the atlas while no context is within a frame (ImFontAtlasUpdateNewFrame()).
+// - The same frames are first run sequentially on a separate atlas without LockFunc: the exit code is 1 if the
+//   vertex positions output by the threaded run differ.
+
+#include "imgui.h"
+#include "imgui_internal.h" // For ImFontAtlasUpdateNewFrame(), ImTextCharToUtf8()
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#error "stress_threads.cpp requires imgui to be built with IMGUI_USE_THREAD_LOCAL_CONTEXT"
+#endif
+
+//-----------------------------------------------------------------------------
+// Threading helpers (C++11: no std::shared_mutex, no std::barrier)
+//-----------------------------------------------------------------------------
+
+// Readers-writer lock
+struct SharedMutex
+{
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    int                     Readers = 0;
+    bool                    Writer = false;
+
+    void LockShared()       { std::unique_lock<std::mutex> lock(Mutex); Cond.wait(lock, [this] { return !Writer; }); Readers++; }
+    void UnlockShared()     { std::unique_lock<std::mutex> lock(Mutex); if (--Readers == 0) Cond.notify_all(); }
+    void LockExclusive()    { std::unique_lock<std::mutex> lock(Mutex); Cond.wait(lock, [this] { return !Writer && Readers == 0; }); Writer = true; }
+    void UnlockExclusive()  { std::unique_lock<std::mutex> lock(Mutex); Writer = false; Cond.notify_all(); }
+};
+
+struct Barrier
+{
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    int                     Count;
+    int                     Waiting = 0;
+    int                     Generation = 0;
+
+    Barrier(int count) : Count(count) {}
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        const int generation = Generation;
+        if (++Waiting == Count)
+        {
+            Waiting = 0;
+            Generation++;
+            Cond.notify_all();
+            return;
+        }
+        Cond.wait(lock, [this, generation] { return Generation != generation; });
+    }
+};
+
+static SharedMutex g_AtlasMutex;
+
+static void AtlasLockFunc(ImFontAtlas* atlas, ImFontAtlasLockOp op)
+{
+    IM_UNUSED(atlas);
+    switch (op)
+    {
+    case ImFontAtlasLockOp_LockShared:      g_AtlasMutex.LockShared(); break;
+    case ImFontAtlasLockOp_UnlockShared:    g_AtlasMutex.UnlockShared(); break;
+    case ImFontAtlasLockOp_LockExclusive:   g_AtlasMutex.LockExclusive(); break;
+    case ImFontAtlasLockOp_UnlockExclusive: g_AtlasMutex.UnlockExclusive(); break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Frame
+//-----------------------------------------------------------------------------
+
+static void RunFrame(int thread_n, int cycle, ImFont* font)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(600.0f, 700.0f));
+    ImGui::Begin("Stress", NULL, ImGuiWindowFlags_NoSavedSettings);
+    for (int line = 0; line < 40; line++)
+    {
+        // Codepoints from ASCII, Latin-1 and Latin Extended-A (some are missing from the default font)
+        char buf[20 * 4 + 1];
+        int len = 0;
+        for (int n = 0; n < 20; n++)
+            len += ImTextCharToUtf8(buf + len, 0x20 + (unsigned int)((thread_n * 31 + line * 17 + n * 13 + cycle * 5) % 0x160));
+        buf[len] = 0;
+        ImGui::PushFont(font, 10.0f + (float)((thread_n * 7 + line * 3 + cycle) % 30));
+        ImGui::TextUnformatted(buf);
+        ImGui::PopFont();
+    }
+    ImGui::Button("Button");
+    ImGui::End();
+    ImGui::Render();
+}
+
+// Hash vertex positions only: texture coordinates depend on the order glyphs were packed in.
+static ImU64 HashDrawDataPositions(ImDrawData* draw_data)
+{
+    ImU64 hash = 14695981039346656037ULL;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+        {
+            hash = (hash ^ (ImU64)(int)(vtx.pos.x * 16.0f)) * 1099511628211ULL;
+            hash = (hash ^ (ImU64)(int)(vtx.pos.y * 16.0f)) * 1099511628211ULL;
+        }
+    return hash;
+}
+
+// Acknowledge texture requests, as a renderer backend would do
+static void UpdateTextures(ImFontAtlas* atlas)
+{
+    for (ImTextureData* tex : atlas->TexList)
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            tex->SetStatus(ImTextureStatus_OK);
+        else if (tex->Status == ImTextureStatus_WantDestroy)
+            tex->SetStatus(ImTextureStatus_Destroyed);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+static ImU64 Run(int threads_count, int cycles_count, bool threaded)
+{
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    atlas->LockFunc = threaded ? AtlasLockFunc : NULL;
+    atlas->TexMinWidth = atlas->TexMinHeight = 128; // Force texture growth
+    ImFont* font = atlas->AddFontDefault();
+    ImFontAtlasUpdateNewFrame(atlas, 1, true);
+
+    ImVector<ImGuiContext*> contexts;
+    ImVector<ImU64> hashes;
+    contexts.resize(threads_count);
+    hashes.resize(threads_count, 0);
+    for (int n = 0; n < threads_count; n++)
+    {
+        contexts[n] = ImGui::CreateContext(atlas);
+        ImGui::SetCurrentContext(contexts[n]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        io.DisplaySize = ImVec2(800.0f, 800.0f);
+    }
+
+    if (threaded)
+    {
+        Barrier barrier(threads_count + 1);
+        ImVector<std::thread*> threads;
+        for (int n = 0; n < threads_count; n++)
+            threads.push_back(new std::thread([&, n]()
+            {
+                ImGui::SetCurrentContext(contexts[n]); // Thread local
+                for (int cycle = 0; cycle < cycles_count; cycle++)
+                {
+                    RunFrame(n, cycle, font);
+                    hashes[n] = hashes[n] * 31 + HashDrawDataPositions(ImGui::GetDrawData());
+                    barrier.Wait(); // Main thread updates atlas
+                    barrier.Wait();
+                }
+            }));
+        for (int cycle = 0; cycle < cycles_count; cycle++)
+        {
+            barrier.Wait(); // No context is within a frame
+            UpdateTextures(atlas);
+            ImFontAtlasUpdateNewFrame(atlas, cycle + 2, true);
+            barrier.Wait();
+        }
+        for (std::thread* thread : threads)
+        {
+            thread->join();
+            delete thread;
+        }
+    }
+    else
+    {
+        for (int cycle = 0; cycle < cycles_count; cycle++)
+        {
+            for (int n = 0; n < threads_count; n++)
+            {
+                ImGui::SetCurrentContext(contexts[n]);
+                RunFrame(n, cycle, font);
+                hashes[n] = hashes[n] * 31 + HashDrawDataPositions(ImGui::GetDrawData());
+            }
+            UpdateTextures(atlas);
+            ImFontAtlasUpdateNewFrame(atlas, cycle + 2, true);
+        }
+    }
+
+    ImU64 hash = 0;
+    for (int n = 0; n < threads_count; n++)
+        hash = hash * 31 + hashes[n];
+    printf("%-10s threads: %d, cycles: %d, baked sizes: %d, texture: %dx%d, hash: %016llx\n", threaded ? "threaded" : "sequential",
+        threads_count, cycles_count, atlas->Builder->BakedPool.Size, atlas->TexData->Width, atlas->TexData->Height, (unsigned long long)hash);
+
+    for (ImGuiContext* ctx : contexts)
+        ImGui::DestroyContext(ctx);
+    IM_DELETE(atlas);
+    return hash;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const int threads_count = (argc > 1) ? atoi(argv[1]) : 8;
+    const int cycles_count = (argc > 2) ? atoi(argv[2]) : 200;
+    if (threads_count < 1 || cycles_count < 1)
+    {
+        fprintf(stderr, "Usage: %s [THREADS] [CYCLES]\n", argv[0]);
+        return 2;
+    }
+
+    const ImU64 hash_sequential = Run(threads_count, cycles_count, false);
+    const ImU64 hash_threaded = Run(threads_count, cycles_count, true);
+    if (hash_sequential != hash_threaded)
+    {
+        printf("FAILED: threaded output differs from sequential output!\n");
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
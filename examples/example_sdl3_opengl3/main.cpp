@@ -147,6 +147,12 @@ int main(int, char**)
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
         // [If using SDL_MAIN_USE_CALLBACKS: call ImGui_ImplSDL3_ProcessEvent() from your SDL_AppEvent() function]
+        // We wait for events until io.NextWakeupDelay, so an idle UI doesn't run the main loop at full frame rate.
+        // Remove the call to SDL_WaitEventTimeout() if your application needs to render continuously (e.g. a game, or to read gamepad inputs).
+#ifndef __EMSCRIPTEN__
+        if (io.NextWakeupDelay > 0.0f)
+            SDL_WaitEventTimeout(nullptr, (io.NextWakeupDelay >= FLT_MAX) ? -1 : (int)(io.NextWakeupDelay * 1000.0f) + 1); // -1 = wait indefinitely
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
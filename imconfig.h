@@ -54,6 +54,10 @@
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
 
+//---- Enable built-in profiler: record timings of core functions (NewFrame, Begin, tables layout, text rendering, atlas updates...) in a ring buffer.
+// View in Metrics/Debugger window > Profiler, export to Chrome trace format. Add your own zones with IMGUI_PROFILER_ZONE() from imgui_internal.h. Compiled out when not defined.
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -65,6 +69,10 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Store the current context pointer (GImGui) in thread local storage, so N threads can each update their own context concurrently.
+// Not compatible with building Dear ImGui as a DLL. Read comments above 'ImGuiContext* GImGui' in imgui.cpp and ImFontAtlas::LockFunc for details.
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -118,6 +126,11 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use compact 12 bytes vertices (default is 20 bytes): 16-bit fixed point positions and 16-bit normalized UVs.
+// Reduce vertex upload bandwidth, at the cost of 1/8 pixel position precision within a -4096..+4095 range and no UV wrapping.
+// Your renderer backend will need to support it (only imgui_impl_opengl3 does at the moment). See ImDrawVert in imgui.h for details.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
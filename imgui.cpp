@@ -68,6 +68,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
@@ -90,11 +91,14 @@ CODE
 // [SECTION] WINDOW FOCUS
 // [SECTION] KEYBOARD/GAMEPAD NAVIGATION
 // [SECTION] DRAG AND DROP
+// [SECTION] SUB-CONTEXTS
 // [SECTION] LOGGING/CAPTURING
 // [SECTION] SETTINGS
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
+// [SECTION] HITCH RECORDER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -1141,6 +1145,7 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#include <time.h>       // clock_gettime, clock (ImTimeGetNs)
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1174,6 +1179,7 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 // [Apple] OS specific includes
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
+#include <mach/mach_time.h> // mach_absolute_time (ImTimeGetNs)
 #endif
 
 // Visual Studio warnings
@@ -1266,6 +1272,14 @@ static void             Platform_SetClipboardTextFn_DefaultImpl(ImGuiContext* ct
 static void             Platform_SetImeDataFn_DefaultImpl(ImGuiContext* ctx, ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 static bool             Platform_OpenInShellFn_DefaultImpl(ImGuiContext* ctx, const char* path);
 
+// Hitch recorder
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+static void             DebugHitchesAddEvent(ImGuiContext* ctx, ImGuiDebugHitchEventType type, ImU64 time);
+static void             DebugHitchesNewFrame(ImGuiContext* ctx);
+static void             DebugHitchesEndFrame(ImGuiContext* ctx);
+static void             DebugHitchesSubmitFrame(ImGuiContext* ctx);
+#endif
+
 namespace ImGui
 {
 // Item
@@ -1318,6 +1332,7 @@ static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
 static void             UpdateSettings();
+static float            CalcNextWakeupDelay();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1349,17 +1364,24 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - Change this variable to use thread local storage so each thread can refer to a different context:
+//     - Simply '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in your imconfig.h. Not compatible with DLL builds (thread_local variables cannot be exported).
+//     - Or, if you need a compiler-specific keyword or a different storage, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
-//     And then define MyImGuiTLS in one of your cpp files. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//       And then define MyImGuiTLS in one of your cpp files. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//   - Contexts updated from different threads may share a font atlas if you provide locking primitives, see ImFontAtlas::LockFunc.
 //   - Future development aims to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
@@ -1540,6 +1562,10 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryHibernateTimer = -1.0f;
+    ConfigDrawDataMergeDrawLists = false;
+    ConfigDrawDataFingerprint = false;
+    ConfigDrawListRectInstances = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2457,6 +2483,34 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Time functions)
+//-----------------------------------------------------------------------------
+
+// Monotonic clock in nanoseconds, only used by profiling/debug tools.
+#if defined(IMGUI_ENABLE_PROFILER) || !defined(IMGUI_DISABLE_DEBUG_TOOLS)
+ImU64 ImTimeGetNs()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER frequency, counter; // Not caching frequency in a static, as contexts may be updated from multiple threads
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+    const ImU64 ticks = (ImU64)counter.QuadPart, ticks_per_second = (ImU64)frequency.QuadPart;
+    return (ticks / ticks_per_second) * 1000000000ULL + (ticks % ticks_per_second) * 1000000000ULL / ticks_per_second; // Avoid overflow
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    return (ImU64)mach_absolute_time() * timebase.numer / timebase.denom;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000ULL + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)clock() * 1000000000ULL / (ImU64)CLOCKS_PER_SEC; // Fallback: processor time
+#endif
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2651,13 +2705,49 @@ int ImTextCountLines(const char* in_text, const char* in_text_end)
     if (in_text_end == NULL)
         in_text_end = in_text + ImStrlen(in_text); // FIXME-OPT: Not optimal approach, discourage use for now.
     int count = 0;
-    while (in_text < in_text_end)
+    ImTextSkipLines(in_text, in_text_end, INT_MAX, &count);
+    return count;
+}
+
+// Skip up to 'lines_count' lines, return the beginning of the next line (or in_text_end). A trailing line without carriage return counts as a line.
+// This is used to coarse clip large text: calculate the index of the first visible line from its position, then skip straight to it.
+// With SSE2 we scan 16 bytes at a time, which is much faster than calling memchr() for each (typically short) line.
+const char* ImTextSkipLines(const char* in_text, const char* in_text_end, int lines_count, int* out_lines_skipped)
+{
+    int lines_skipped = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (lines_skipped < lines_count && in_text_end - in_text > 16) // Leave at least one byte to the scalar loop, which counts a trailing line without carriage return
+    {
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(const void*)in_text), newline));
+        unsigned int mask_count = mask - ((mask >> 1) & 0x5555); // Count set bits in 16-bit mask
+        mask_count = (mask_count & 0x3333) + ((mask_count >> 2) & 0x3333);
+        mask_count = (mask_count + (mask_count >> 4)) & 0x0F0F;
+        mask_count = (mask_count + (mask_count >> 8)) & 0x1F;
+        if (lines_skipped + (int)mask_count < lines_count)
+        {
+            lines_skipped += (int)mask_count;
+            in_text += 16;
+            continue;
+        }
+        for (; lines_skipped + 1 < lines_count; lines_skipped++) // Last line to skip ends within this block: clear lower bits until we reach it
+            mask &= mask - 1;
+        int offset = 0;
+        while ((mask & (1u << offset)) == 0)
+            offset++;
+        in_text += offset + 1;
+        lines_skipped++;
+    }
+#endif
+    while (lines_skipped < lines_count && in_text < in_text_end)
     {
         const char* line_end = (const char*)ImMemchr(in_text, '\n', in_text_end - in_text);
         in_text = line_end ? line_end + 1 : in_text_end;
-        count++;
+        lines_skipped++;
     }
-    return count;
+    if (out_lines_skipped)
+        *out_lines_skipped = lines_skipped;
+    return in_text;
 }
 
 IM_MSVC_RUNTIME_CHECKS_RESTORE
@@ -3729,9 +3819,8 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
-// FIXME-OPT: Since we have or calculate text_size we could coarse clip whole block immediately, especially for text above draw_list->DrawList.
-// Effectively as this is called from widget doing their own coarse clipping it's not very valuable presently. Next time function will take
-// better advantage of the render function taking size into account for coarse clipping.
+// Since we have or calculate text_size, we coarse clip the whole block against both clipping rectangles before calling the render function.
+// Most callers are widgets doing their own coarse clipping, but this is valuable for large blocks and for direct calls.
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
 {
     // Perform CPU side clipping for single clipped element to avoid using scissor state
@@ -3748,6 +3837,14 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     if (align.x > 0.0f) pos.x = ImMax(pos.x, pos.x + (pos_max.x - pos.x - text_size.x) * align.x);
     if (align.y > 0.0f) pos.y = ImMax(pos.y, pos.y + (pos_max.y - pos.y - text_size.y) * align.y);
 
+    // Coarse clip whole block. Use a margin of one font size as glyphs may overhang their advance or line height.
+    ImVec4 coarse_clip_rect = draw_list->_CmdHeader.ClipRect;
+    if (need_clipping)
+        coarse_clip_rect = ImVec4(ImMax(coarse_clip_rect.x, clip_min->x), ImMax(coarse_clip_rect.y, clip_min->y), ImMin(coarse_clip_rect.z, clip_max->x), ImMin(coarse_clip_rect.w, clip_max->y));
+    const float margin = draw_list->_Data->FontSize;
+    if (pos.x - margin >= coarse_clip_rect.z || pos.y - margin >= coarse_clip_rect.w || pos.x + text_size.x + margin <= coarse_clip_rect.x || pos.y + text_size.y + margin <= coarse_clip_rect.y)
+        return;
+
     // Render
     if (need_clipping)
     {
@@ -4001,6 +4098,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     InputTextState.Ctx = this;
 
     Initialized = false;
+    FontAtlasesLockShared = false;
+    FontAtlasesLockWriteDepth = 0;
     Font = NULL;
     FontBaked = NULL;
     FontSize = FontSizeBase = FontBakedScale = CurrentDpiScale = 0.0f;
@@ -4021,8 +4120,10 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
     InputEventsNextEventId = 1;
 
+    WindowsHibernateNextTime = 0.0;
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
+    WindowsRefreshStyleHash = 0;
     CurrentWindow = NULL;
     HoveredWindow = NULL;
     HoveredWindowUnderMovingWindow = NULL;
@@ -4203,6 +4304,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugItemPickerBreakId = 0;
     DebugFlashStyleColorTime = 0.0f;
     DebugFlashStyleColorIdx = ImGuiCol_COUNT;
+    DebugCostsEnabled = false;
+    DebugCostsWindow = NULL;
+    DebugCostsLastTime = 0;
 
     // Same as DebugBreakClearData(). Those fields are scattered in their respective subsystem to stay in hot-data locations
     DebugBreakInWindow = 0;
@@ -4215,6 +4319,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
     FramerateSecPerFrameAccum = 0.0f;
     WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+    WakeupDelay = FLT_MAX;
     memset(TempKeychordName, 0, sizeof(TempKeychordName));
 }
 
@@ -4284,6 +4389,7 @@ void ImGui::Shutdown()
     ImGuiContext& g = *GImGui;
     IM_ASSERT_USER_ERROR(g.IO.BackendPlatformUserData == NULL, "Forgot to shutdown Platform backend?");
     IM_ASSERT_USER_ERROR(g.IO.BackendRendererUserData == NULL, "Forgot to shutdown Renderer backend?");
+    ImFontAtlasLockContextShared(&g, false);
 
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
     for (ImFontAtlas* atlas : g.FontAtlases)
@@ -4296,6 +4402,7 @@ void ImGui::Shutdown()
         }
     }
     g.DrawListSharedData.TempBuffer.clear();
+    g.FrameArena.Clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4311,9 +4418,13 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsRecentlyActive.clear();
+    g.WindowsActiveDisplayOrder.clear();
+    g.WindowsHitGrid = ImGuiWindowHitGrid();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
+    g.WindowsHibernated.Clear();
     g.NavWindow = NULL;
     g.HoveredWindow = g.HoveredWindowUnderMovingWindow = NULL;
     g.ActiveIdWindow = NULL;
@@ -4332,13 +4443,11 @@ void ImGui::Shutdown()
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
-    g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
-    g.DrawChannelsTempMergeBuffer.clear();
 
     g.MultiSelectStorage.Clear();
     g.MultiSelectTempData.clear_destruct();
@@ -4362,6 +4471,7 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    g.DebugHitchRecorder.Records.clear();
 
     g.Initialized = false;
 }
@@ -4434,9 +4544,67 @@ ImGuiWindow::~ImGuiWindow()
     ColumnsStorage.clear_destruct();
 }
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+// Attribute time elapsed since last change to the window we are leaving (Metrics/Debugger > Costs)
+static void DebugCostsSetCurrentWindow(ImGuiContext& g, ImGuiWindow* window)
+{
+    const ImU64 time = ImTimeGetNs();
+    if (g.DebugCostsWindow != NULL)
+        g.DebugCostsWindow->DebugCosts.TimeNs += time - g.DebugCostsLastTime;
+    g.DebugCostsWindow = window;
+    g.DebugCostsLastTime = time;
+}
+
+static void DebugCostsAddCounters(ImGuiContext& g, int items_count, int text_bytes, int alloc_count)
+{
+    if (ImGuiWindow* window = g.CurrentWindow)
+    {
+        window->DebugCosts.ItemsCount += items_count;
+        window->DebugCosts.TextBytes += text_bytes;
+        window->DebugCosts.AllocCount += alloc_count;
+    }
+    if (ImGuiTable* table = g.CurrentTable)
+    {
+        table->DebugCosts.ItemsCount += items_count;
+        table->DebugCosts.TextBytes += text_bytes;
+        table->DebugCosts.AllocCount += alloc_count;
+    }
+}
+
+// Fold current frame values into moving averages. Windows and tables not submitted this frame are folded with zero values, so they decay.
+static void DebugCostsUpdateAverages(ImGuiDebugCosts* costs)
+{
+    const float k = 1.0f / 30.0f;
+    costs->TimeAvg += ((float)costs->TimeNs * 0.001f - costs->TimeAvg) * k;
+    costs->ItemsCountAvg += ((float)costs->ItemsCount - costs->ItemsCountAvg) * k;
+    costs->TextBytesAvg += ((float)costs->TextBytes - costs->TextBytesAvg) * k;
+    costs->AllocCountAvg += ((float)costs->AllocCount - costs->AllocCountAvg) * k;
+    costs->TimeNs = 0;
+    costs->ItemsCount = costs->TextBytes = costs->AllocCount = 0;
+}
+
+static void DebugCostsEndFrame(ImGuiContext& g)
+{
+    if (g.DebugCostsEnabled)
+    {
+        DebugCostsSetCurrentWindow(g, NULL);
+        for (ImGuiWindow* window : g.Windows)
+            DebugCostsUpdateAverages(&window->DebugCosts);
+        for (int n = 0; n < g.Tables.GetMapSize(); n++)
+            if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+                DebugCostsUpdateAverages(&table->DebugCosts);
+    }
+    g.DebugCostsWindow = NULL; // Also clear when recording was disabled during the frame
+}
+#endif
+
 static void SetCurrentWindow(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugCostsEnabled)
+        DebugCostsSetCurrentWindow(g, window);
+#endif
     g.CurrentWindow = window;
     g.StackSizesInBeginForCurrentWindow = g.CurrentWindow ? &g.CurrentWindowStack.back().StackSizesInBegin : NULL;
     g.CurrentTable = window && window->DC.CurrentTableIdx != -1 ? g.Tables.GetByIndex(window->DC.CurrentTableIdx) : NULL;
@@ -4474,6 +4642,7 @@ void ImGui::GcCompactTransientMiscBuffers()
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_GcCompact);
     window->MemoryCompacted = true;
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
@@ -4494,6 +4663,152 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+// Destroy windows which haven't been active since 'hibernate_start_time', unless something still points to them.
+// A window only referenced by other candidates (e.g. parent of an unused child window) will be destroyed on a subsequent call.
+void ImGui::GcHibernateWindows(float hibernate_start_time)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiWindow*>& candidates = g.WindowsTempSortBuffer;
+    candidates.resize(0);
+    for (ImGuiWindow* window : g.Windows)
+    {
+        window->MemoryHibernateBlocked = false;
+        if (!window->WasActive && !window->Active && window->LastTimeActive < hibernate_start_time)
+            candidates.push_back(window);
+    }
+    if (candidates.Size == 0)
+        return;
+
+    // Block windows referenced by other windows
+    for (ImGuiWindow* window : g.Windows)
+    {
+        ImGuiWindow* refs[] = { window->ParentWindow, window->ParentWindowInBeginStack, window->RootWindow, window->RootWindowPopupTree, window->RootWindowForTitleBarHighlight, window->RootWindowForNav, window->ParentWindowForFocusRoute, window->NavLastChildNavWindow };
+        for (ImGuiWindow* ref : refs)
+            if (ref != NULL && ref != window)
+                ref->MemoryHibernateBlocked = true;
+    }
+
+    // Block windows referenced by the context
+    ImGuiWindow* ctx_refs[] = { g.CurrentWindow, g.HoveredWindow, g.HoveredWindowUnderMovingWindow, g.HoveredWindowBeforeClear, g.MovingWindow, g.WheelingWindow, g.ActiveIdWindow, g.NavWindow, g.NavWindowingTarget, g.NavWindowingTargetAnim, g.NavWindowingListWindow, g.TooltipPreviousWindow, g.LogWindow };
+    for (ImGuiWindow* ref : ctx_refs)
+        if (ref != NULL)
+            ref->MemoryHibernateBlocked = true;
+    if (g.BoxSelectState.IsActive && g.BoxSelectState.Window != NULL)
+        g.BoxSelectState.Window->MemoryHibernateBlocked = true;
+    for (ImGuiPopupData& popup_data : g.OpenPopupStack)
+    {
+        if (popup_data.Window)
+            popup_data.Window->MemoryHibernateBlocked = true;
+        if (popup_data.RestoreNavWindow)
+            popup_data.RestoreNavWindow->MemoryHibernateBlocked = true;
+    }
+    for (ImGuiWindowStackData& stack_data : g.CurrentWindowStack)
+        stack_data.Window->MemoryHibernateBlocked = true;
+
+    int hibernate_count = 0;
+    for (ImGuiWindow* window : candidates)
+        if (!window->MemoryHibernateBlocked)
+            candidates[hibernate_count++] = window;
+    candidates.resize(hibernate_count);
+    GcHibernateWindowList(candidates);
+    candidates.resize(0);
+}
+
+// Remove windows marked with MemoryHibernatePending from a list, preserving order. Return number of removed windows.
+static int GcEraseHibernatePendingWindows(ImVector<ImGuiWindow*>& windows)
+{
+    int dst_n = 0;
+    for (ImGuiWindow* window : windows)
+        if (!window->MemoryHibernatePending)
+            windows[dst_n++] = window;
+    const int erased_count = windows.Size - dst_n;
+    windows.resize(dst_n);
+    return erased_count;
+}
+
+// Destroy windows, keeping a compact record of their persistent state (restored by CreateNewWindow() on next Begin()).
+// Caller is responsible for ensuring that no other window or context field still points to them (see GcHibernateWindows()).
+// Pooled data (tables, tab bars, multi-select storage) may still point to them: we clear those pointers, they are set again on next use.
+// Windows are unlinked in a single pass over each context list, so hibernating many windows at once stays linear.
+void ImGui::GcHibernateWindowList(const ImVector<ImGuiWindow*>& windows)
+{
+    ImGuiContext& g = *GImGui;
+    if (windows.Size == 0)
+        return;
+
+    // Store persistent state
+    for (ImGuiWindow* window : windows)
+    {
+        IM_ASSERT(!window->Active && !window->WasActive && window != g.NavWindow);
+        //IMGUI_DEBUG_PRINT("GcHibernateWindowList() '%s'\n", window->Name);
+        window->MemoryHibernatePending = true;
+        ImGuiWindowHibernateData* data = g.WindowsHibernated.GetOrAddByKey(window->ID);
+        data->ID = window->ID;
+        data->Pos = window->Pos;
+        data->SizeFull = window->SizeFull;
+        data->Scroll = window->Scroll;
+        data->Collapsed = window->Collapsed;
+        data->StateStorage.Data.swap(window->StateStorage.Data);
+        for (ImGuiOldColumns& columns : window->ColumnsStorage)
+            columns.Splitter.ClearFreeMemory();
+        data->ColumnsStorage.swap(window->ColumnsStorage);
+
+        // Write .ini settings now, as WindowSettingsHandler_WriteAll() only gathers data from existing windows
+        if (!(window->Flags & ImGuiWindowFlags_NoSavedSettings))
+        {
+            ImGuiWindowSettings* settings = FindWindowSettingsByWindow(window);
+            if (!settings)
+                settings = CreateNewWindowSettings(window->Name);
+            IM_ASSERT(settings->ID == window->ID);
+            settings->Pos = ImVec2ih(window->Pos);
+            settings->Size = ImVec2ih(window->SizeFull);
+            settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+            settings->Collapsed = window->Collapsed;
+            settings->WantDelete = false;
+        }
+    }
+
+    // Unlink from context
+    GcEraseHibernatePendingWindows(g.Windows);
+    if (GcEraseHibernatePendingWindows(g.WindowsActiveDisplayOrder) > 0)
+        g.WindowsHitGrid.Invalidate();
+    GcEraseHibernatePendingWindows(g.WindowsRecentlyActive);
+    if (GcEraseHibernatePendingWindows(g.WindowsFocusOrder) > 0)
+        for (int n = 0; n < g.WindowsFocusOrder.Size; n++)
+            g.WindowsFocusOrder[n]->FocusOrder = (short)n;
+    for (ImGuiWindow* window : windows)
+    {
+        g.WindowsById.SetVoidPtr(window->ID, NULL);
+        if (window->ParentWindow != NULL)
+            window->ParentWindow->DC.ChildWindows.find_erase(window);
+    }
+    if (g.DebugCostsWindow != NULL && g.DebugCostsWindow->MemoryHibernatePending)
+        g.DebugCostsWindow = NULL;
+
+    // Clear references held by pooled data and stale navigation results
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+            if ((table->OuterWindow && table->OuterWindow->MemoryHibernatePending) || (table->InnerWindow && table->InnerWindow->MemoryHibernatePending))
+                table->OuterWindow = table->InnerWindow = NULL;
+    for (int n = 0; n < g.TabBars.GetMapSize(); n++)
+        if (ImGuiTabBar* tab_bar = g.TabBars.TryGetMapData(n))
+            if (tab_bar->Window && tab_bar->Window->MemoryHibernatePending)
+                tab_bar->Window = NULL;
+    for (int n = 0; n < g.MultiSelectStorage.GetMapSize(); n++)
+        if (ImGuiMultiSelectState* ms = g.MultiSelectStorage.TryGetMapData(n))
+            if (ms->Window && ms->Window->MemoryHibernatePending)
+                ms->Window = NULL;
+    if (g.BoxSelectState.Window && g.BoxSelectState.Window->MemoryHibernatePending)
+        g.BoxSelectState.Window = NULL;
+    ImGuiNavItemData* nav_results[] = { &g.NavInitResult, &g.NavMoveResultLocal, &g.NavMoveResultLocalVisible, &g.NavMoveResultOther, &g.NavTabbingResultFirst };
+    for (ImGuiNavItemData* result : nav_results)
+        if (result->Window && result->Window->MemoryHibernatePending)
+            result->Clear();
+
+    for (ImGuiWindow* window : windows)
+        IM_DELETE(window);
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4727,10 +5042,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestWakeup(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestWakeup(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4893,13 +5214,47 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+// Allocate transient memory, valid until the next NewFrame() call.
+// Prefer this over a local ImVector<> or a persistent scratch buffer for data which doesn't need to outlive the frame.
+void* ImGui::FrameMemAlloc(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
+static void UpdateFrameArenaNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImLinearAllocator* arena = &g.FrameArena;
+    ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+    info->FrameArenaAllocCount = arena->AllocCount;
+    info->FrameArenaAllocSize = arena->GetUsedSize();
+    if (arena->OverflowBlocks.Size > 0)
+        info->FrameArenaOverflowCount++;
+    if (g.GcCompactAll)
+        arena->Clear();
+    else
+        arena->Reset();
+}
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext* ctx = GImGui;
+    const bool is_large_alloc = (ctx != NULL && ctx->DebugHitchRecorder.Enabled && size >= ctx->DebugHitchRecorder.LargeAllocThreshold);
+    const ImU64 time_begin = is_large_alloc ? ImTimeGetNs() : 0;
+#endif
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    if (ImGuiContext* ctx = GImGui)
+    if (ctx != NULL)
+    {
+        if (is_large_alloc)
+            DebugHitchesAddEvent(ctx, ImGuiDebugHitchEventType_LargeAlloc, ImTimeGetNs() - time_begin);
         DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (ctx->DebugCostsEnabled)
+            DebugCostsAddCounters(*ctx, 0, 0, 1);
+    }
 #endif
     return ptr;
 }
@@ -4920,6 +5275,14 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
 {
     ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[info->LastEntriesIdx];
     IM_UNUSED(ptr);
+
+    // [DEBUG] Debug break requested by user: inspect the callstack to find the source of an unexpected allocation
+    if (info->DebugBreakInAlloc)
+    {
+        info->DebugBreakInAlloc = false;
+        IM_DEBUG_BREAK();
+    }
+
     if (entry->FrameCount != frame_count)
     {
         info->LastEntriesIdx = (info->LastEntriesIdx + 1) % IM_ARRAYSIZE(info->LastEntriesBuf);
@@ -5003,6 +5366,14 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+// Request a new frame within 'delay' seconds even without new inputs. Lowest requested delay wins.
+// Used by widgets relying on timers (e.g. blinking text cursor, hover delays), output in io.NextWakeupDelay.
+void ImGui::RequestWakeup(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.WakeupDelay = ImMin(g.WakeupDelay, ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -5281,6 +5652,8 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowRectInstances;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
 }
 
@@ -5288,6 +5661,10 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("NewFrame");
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugHitchesNewFrame(&g);
+#endif
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -5295,6 +5672,9 @@ void ImGui::NewFrame()
         if (g.Hooks[n].Type == ImGuiContextHookType_PendingRemoval_)
             g.Hooks.erase(&g.Hooks[n]);
 
+    // Rewind transient allocations from previous frame
+    UpdateFrameArenaNewFrame();
+
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
     // Check and assert for various common IO and Configuration mistakes
@@ -5323,6 +5703,9 @@ void ImGui::NewFrame()
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
+    // Hold a shared lock on font atlases shared with contexts updated from other threads, until EndFrame() (see ImFontAtlas::LockFunc)
+    ImFontAtlasLockContextShared(&g, true);
+
     // Update texture list (collect destroyed textures, etc.)
     UpdateTexturesNewFrame();
 
@@ -5446,9 +5829,12 @@ void ImGui::NewFrame()
     UpdateMouseInputs();
 
     // Mark all windows as not visible and compact unused memory.
+    // We only need to iterate recently active windows: other windows already have Active == WasActive == false and their buffers compacted.
+    // A window leaves the list once it has been inactive for a full frame and its buffers have been compacted (or compaction is disabled).
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
-    for (ImGuiWindow* window : g.Windows)
+    int recently_active_count = 0;
+    for (ImGuiWindow* window : g.WindowsRecentlyActive)
     {
         window->WasActive = window->Active;
         window->Active = false;
@@ -5459,7 +5845,17 @@ void ImGui::NewFrame()
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+
+        if (window->WasActive || (!window->MemoryCompacted && g.IO.ConfigMemoryCompactTimer >= 0.0f))
+            g.WindowsRecentlyActive[recently_active_count++] = window;
+        else
+            window->InRecentlyActiveList = false;
     }
+    g.WindowsRecentlyActive.resize(recently_active_count);
+    if (g.GcCompactAll)
+        for (ImGuiWindow* window : g.Windows)
+            if (!window->WasActive && !window->Active && !window->MemoryCompacted)
+                GcCompactTransientWindowBuffers(window);
 
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
@@ -5477,6 +5873,7 @@ void ImGui::NewFrame()
 
     g.MouseCursor = ImGuiMouseCursor_Arrow;
     g.WantCaptureMouseNextFrame = g.WantCaptureKeyboardNextFrame = g.WantTextInputNextFrame = -1;
+    g.WakeupDelay = FLT_MAX;
 
     // Platform IME data: reset for the frame
     g.PlatformImeDataPrev = g.PlatformImeData;
@@ -5494,6 +5891,14 @@ void ImGui::NewFrame()
             TableGcCompactTransientBuffers(&table_temp_data);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
+
+    // Destroy windows unused for a long time, keeping a compact record of their state
+    // (this scans all windows, so we only do it about once per second)
+    if (g.IO.ConfigMemoryHibernateTimer >= 0.0f && (g.GcCompactAll || g.Time >= g.WindowsHibernateNextTime))
+    {
+        GcHibernateWindows(g.GcCompactAll ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryHibernateTimer);
+        g.WindowsHibernateNextTime = g.Time + 1.0;
+    }
     g.GcCompactAll = false;
 
     // Closing the focused window restore focus to the first active root window in descending z-order
@@ -5563,6 +5968,35 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
+static int IMGUI_CDECL WindowAddressComparer(const void* lhs, const void* rhs)
+{
+    const uintptr_t a = (uintptr_t)*(const ImGuiWindow* const*)lhs;
+    const uintptr_t b = (uintptr_t)*(const ImGuiWindow* const*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static int IMGUI_CDECL WindowIndexComparer(const void* lhs, const void* rhs)
+{
+    const ImGuiWindow* const a = *(const ImGuiWindow* const*)lhs;
+    const ImGuiWindow* const b = *(const ImGuiWindow* const*)rhs;
+    return a->WindowsIndex - b->WindowsIndex;
+}
+
+// Binary search in a buffer sorted with WindowAddressComparer()
+static bool ContainsWindowInSortedBuffer(ImGuiWindow* const* sorted_windows, int sorted_windows_count, ImGuiWindow* window)
+{
+    int lo = 0, hi = sorted_windows_count;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if ((uintptr_t)sorted_windows[mid] < (uintptr_t)window)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < sorted_windows_count && sorted_windows[lo] == window;
+}
+
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
     out_sorted_windows->push_back(window);
@@ -5633,7 +6067,7 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
 
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalRectCount = 0;
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -5682,7 +6116,7 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // FIXME: Need to stricty ensure ImDrawCmd are not merged (ElemCount==6 checks below will verify that)
         draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
-        IM_ASSERT(cmd.ElemCount == 6);
+        IM_ASSERT(cmd.ElemCount == 6 || cmd.RectCount == 1);
         draw_list->CmdBuffer.pop_back();
         draw_list->CmdBuffer.push_front(cmd);
         draw_list->AddDrawCmd(); // We need to create a command as CmdBuffer.back().IdxOffset won't be correct if we append to same command.
@@ -5745,11 +6179,85 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Calculate io.NextWakeupDelay: delay after which a new frame is required even without new inputs.
+// This combines delays requested by widgets via RequestWakeup() (blinking text cursor, hover delays) with timers owned by the context.
+// - Return 0.0f when a state is known to be changing over the next frames (e.g. inputs just received, appearing/auto-fitting windows, animations).
+// - Held keys and mouse buttons are assumed to repeat at frame rate once past the shortest repeat delay.
+// - Window hibernation (io.ConfigMemoryHibernateTimer) is not scheduled: it will happen on the next frame, as it doesn't affect output.
+static float ImGui::CalcNextWakeupDelay()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    // Inputs processed this frame often need another frame to settle (e.g. popup opening, hover state), pending inputs need a frame to be processed
+    if (g.InputEventsTrail.Size > 0 || g.InputEventsQueue.Size > 0)
+        return 0.0f;
+
+    // Pending requests and animations
+    const bool dim_bg_enabled = (GetTopMostPopupModal() != NULL || (g.NavWindowingTarget != NULL && g.NavWindowingHighlightAlpha > 0.0f));
+    if (dim_bg_enabled ? (g.DimBgRatio < 1.0f) : (g.DimBgRatio > 0.0f))
+        return 0.0f;
+    if (g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f)
+        return 0.0f;
+    if (g.NavAnyRequest || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0 || io.WantSetMousePos)
+        return 0.0f;
+    if (g.DebugFlashStyleColorTime > 0.0f)
+        return 0.0f;
+    if (io.MouseDrawCursor && (g.MouseCursor == ImGuiMouseCursor_Wait || g.MouseCursor == ImGuiMouseCursor_Progress))
+        return 0.0f;
+    for (ImTextureData* tex : g.PlatformIO.Textures)
+        if (tex->WantDestroyNextFrame || tex->Status == ImTextureStatus_WantDestroy)
+            return 0.0f;
+
+    float delay = g.WakeupDelay;
+
+    // Key repeat
+    const float key_repeat_delay_min = io.KeyRepeatDelay * 0.72f; // Shortest delay from GetTypematicRepeatRate()
+    for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key++)
+    {
+        const ImGuiKeyData* key_data = &io.KeysData[key - ImGuiKey_NamedKey_BEGIN];
+        if (!key_data->Down || IsLRModKey((ImGuiKey)key) || (key >= ImGuiKey_ReservedForModCtrl && key <= ImGuiKey_ReservedForModSuper))
+            continue;
+        if (key == ImGuiKey_GamepadL2 || key == ImGuiKey_GamepadR2 || (key >= ImGuiKey_GamepadLStickLeft && key <= ImGuiKey_GamepadRStickDown))
+            return 0.0f; // Analog inputs are used continuously (e.g. gamepad scrolling, moving windows)
+        if (key_data->DownDuration >= key_repeat_delay_min)
+            return 0.0f;
+        delay = ImMin(delay, key_repeat_delay_min - key_data->DownDuration);
+    }
+
+    // Timers
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        delay = ImMin(delay, g.NavHighlightActivatedTimer);
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+
+    // Windows: appearing/auto-fitting/scrolling/dirty windows need another frame, recently unused windows will have their buffers compacted
+    for (ImGuiWindow* window : g.WindowsRecentlyActive)
+    {
+        if (window->Active)
+        {
+            if (window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0)
+                return 0.0f;
+            if (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->RefreshDirty)
+                return 0.0f;
+            if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+                return 0.0f;
+        }
+        else if (!window->MemoryCompacted && io.ConfigMemoryCompactTimer >= 0.0f)
+        {
+            delay = ImMin(delay, (float)(window->LastTimeActive + io.ConfigMemoryCompactTimer - g.Time));
+        }
+    }
+
+    return ImMax(delay, 0.0f);
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
+    IMGUI_PROFILER_ZONE("EndFrame");
 
     // Don't process EndFrame() multiple times.
     if (g.FrameCountEnded == g.FrameCount)
@@ -5812,6 +6320,9 @@ void ImGui::EndFrame()
     // End frame
     g.WithinFrameScope = false;
     g.FrameCountEnded = g.FrameCount;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugCostsEndFrame(g);
+#endif
     UpdateFontsEndFrame();
 
     // Initiate moving window + handle left-click and right-click focus
@@ -5819,25 +6330,87 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
-    for (ImGuiWindow* window : g.Windows)
+    // To keep this proportional to the number of active windows, we only walk the recently active list and use indices cached in ImGuiWindow::WindowsIndex.
+    // When every active root window is already followed by its active children (the common case), g.Windows[] is left untouched.
+    ImGuiWindow** active_windows = FrameMemAllocArray<ImGuiWindow*>(g.WindowsRecentlyActive.Size);
+    int active_windows_count = 0;
+    int active_roots_count = 0;
+    bool is_sorted = true;
+    for (ImGuiWindow* window : g.WindowsRecentlyActive)
+        if (window->Active)
+        {
+            active_windows[active_windows_count++] = window;
+            if (!(window->Flags & ImGuiWindowFlags_ChildWindow))
+            {
+                active_roots_count++;
+                if (window->WindowsIndex >= g.Windows.Size || g.Windows[window->WindowsIndex] != window)
+                    is_sorted = false;
+            }
+        }
+    g.WindowsActiveDisplayOrder.resize(0);
+    if (is_sorted)
+    {
+        // Fast path: roots sorted by their index, each root expected to be followed by its active children.
+        ImGuiWindow** active_roots = FrameMemAllocArray<ImGuiWindow*>(active_roots_count);
+        active_roots_count = 0;
+        for (int n = 0; n < active_windows_count; n++)
+            if (!(active_windows[n]->Flags & ImGuiWindowFlags_ChildWindow))
+                active_roots[active_roots_count++] = active_windows[n];
+        ImQsort(active_roots, (size_t)active_roots_count, sizeof(ImGuiWindow*), WindowIndexComparer);
+        for (int root_n = 0; root_n < active_roots_count && is_sorted; root_n++)
+        {
+            ImGuiWindow* root_window = active_roots[root_n];
+            const int active_start = g.WindowsActiveDisplayOrder.Size;
+            AddWindowToSortBuffer(&g.WindowsActiveDisplayOrder, root_window);
+            for (int n = active_start; n < g.WindowsActiveDisplayOrder.Size && is_sorted; n++)
+            {
+                const int idx = root_window->WindowsIndex + n - active_start;
+                is_sorted = (idx < g.Windows.Size && g.Windows[idx] == g.WindowsActiveDisplayOrder[n]);
+            }
+        }
+        if (!is_sorted)
+            g.WindowsActiveDisplayOrder.resize(0);
+    }
+    if (!is_sorted)
     {
-        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
-            continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        // Slow path: rebuild the list. Inactive windows are not dereferenced: they are looked up by address and keep their relative order.
+        ImQsort(active_windows, (size_t)active_windows_count, sizeof(ImGuiWindow*), WindowAddressComparer);
+        g.WindowsTempSortBuffer.resize(0);
+        g.WindowsTempSortBuffer.reserve(g.Windows.Size);
+        for (ImGuiWindow* window : g.Windows)
+        {
+            if (!ContainsWindowInSortedBuffer(active_windows, active_windows_count, window))
+            {
+                g.WindowsTempSortBuffer.push_back(window);
+                continue;
+            }
+            if (window->Flags & ImGuiWindowFlags_ChildWindow)       // if a child is active its parent will add it
+                continue;
+            const int active_start = g.WindowsTempSortBuffer.Size;
+            AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+            for (int n = active_start; n < g.WindowsTempSortBuffer.Size; n++)
+                g.WindowsActiveDisplayOrder.push_back(g.WindowsTempSortBuffer[n]);
+        }
+
+        // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
+        IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
+        g.Windows.swap(g.WindowsTempSortBuffer);
+        for (int n = 0; n < g.Windows.Size; n++)
+            g.Windows[n]->WindowsIndex = n;
     }
 
-    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+    // Build hit-testing grid now that windows rectangles and display order are final
+    UpdateWindowsHitGrid();
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     UpdateTexturesEndFrame();
+    g.IO.NextWakeupDelay = CalcNextWakeupDelay();
 
-    // Unlock font atlas
+    // Unlock font atlas (atlases with a LockFunc are shared with contexts on other threads, see UpdateFontsNewFrame())
     for (ImFontAtlas* atlas : g.FontAtlases)
-        atlas->Locked = false;
+        if (atlas->Locked && atlas->LockFunc == NULL)
+            atlas->Locked = false;
+    ImFontAtlasLockContextShared(&g, false);
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5845,6 +6418,10 @@ void ImGui::EndFrame()
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugHitchesEndFrame(&g);
+#endif
+
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -5861,6 +6438,8 @@ void ImGui::Render()
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    ImFontAtlasLockContextShared(&g, true);
+    IMGUI_PROFILER_ZONE("Render");
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
@@ -5880,7 +6459,7 @@ void ImGui::Render()
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingListWindow : NULL);
-    for (ImGuiWindow* window : g.Windows)
+    for (ImGuiWindow* window : g.WindowsActiveDisplayOrder)
     {
         IM_MSVC_WARNING_SUPPRESS(6011); // Static Analysis false positive "warning C6011: Dereferencing NULL pointer 'window'"
         if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_top_most[0] && window != windows_to_render_top_most[1])
@@ -5896,6 +6475,7 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    bool want_render = !g.IO.ConfigDrawDataFingerprint;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -5910,17 +6490,114 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Fingerprint draw data so application may skip rendering unchanged frames (before merging, as merged draw lists are rebuilt every frame)
+        const ImU64 fingerprint_prev = draw_data->Fingerprint;
+        draw_data->Fingerprint = g.IO.ConfigDrawDataFingerprint ? CalcDrawDataFingerprint(draw_data) : 0;
+        if (draw_data->Fingerprint == 0 || draw_data->Fingerprint != fingerprint_prev)
+            want_render = true;
+
+        // Request another frame while output is changing, so layouts relying on previous frame measurements can settle (e.g. auto-resizing windows, new tabs)
+        if (draw_data->Fingerprint != 0 && draw_data->Fingerprint != fingerprint_prev)
+            g.IO.NextWakeupDelay = 0.0f;
+
+        if (g.IO.ConfigDrawDataMergeDrawLists)
+            MergeDrawListsInDrawData(draw_data, &viewport->MergedDrawLists);
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
 
+    // Textures updates need the renderer to run
+    // (backends without ImGuiBackendFlags_RendererHasTextures never process them, e.g. atlas texture stays in ImTextureStatus_WantCreate)
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
+        for (ImTextureData* tex : g.PlatformIO.Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                want_render = true;
+    g.IO.WantRender = want_render;
+
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
         for (ImFontAtlas* atlas : g.FontAtlases)
             ImFontAtlasDebugLogTextureRequests(atlas);
+    DebugHitchesEndFrame(&g);
 #endif
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
+    ImFontAtlasLockContextShared(&g, false);
+}
+
+template<typename T>
+static void ImVectorCopyKeepCapacity(ImVector<T>& dst, const ImVector<T>& src)
+{
+    dst.resize(src.Size);
+    if (src.Size > 0)
+        memcpy(dst.Data, src.Data, (size_t)src.Size * sizeof(T));
+}
+
+// Move current draw data into a snapshot owning its draw lists (see comments above ImDrawDataSnapshot).
+// - Buffers are swapped: the context's draw lists get the buffers previously held by the snapshot, with their capacity, and are left empty.
+// - Texture references are resolved to ImTextureID when already known, so the render thread mostly doesn't need to access ImTextureData.
+void ImGui::TakeDrawDataSnapshot(ImDrawDataSnapshot* snapshot)
+{
+    ImDrawData* src = GetDrawData();
+    IM_ASSERT(src != NULL && "Call after ImGui::Render()!");
+
+    ImDrawData* dst = &snapshot->DrawData;
+    ImVector<ImDrawList*>& pool = snapshot->DrawListsPool;
+    dst->Clear();
+    dst->Valid = src->Valid;
+    dst->DisplayPos = src->DisplayPos;
+    dst->DisplaySize = src->DisplaySize;
+    dst->FramebufferScale = src->FramebufferScale;
+    dst->OwnerViewport = src->OwnerViewport;
+    dst->Fingerprint = src->Fingerprint;
+    while (pool.Size < src->CmdLists.Size)
+        pool.push_back(IM_NEW(ImDrawList)(NULL)); // Not registered in ImDrawListSharedData::DrawLists[]: the UI thread never touches them.
+    for (int n = 0; n < src->CmdLists.Size; n++)
+    {
+        ImDrawList* src_list = src->CmdLists[n];
+        ImDrawList* dst_list = pool[n];
+        if (src_list->_RetainedForNextFrame) // Draw lists which may be displayed again next frame can't have their buffers taken away (see UpdateWindowSkipRefresh())
+        {
+            ImVectorCopyKeepCapacity(dst_list->CmdBuffer, src_list->CmdBuffer);
+            ImVectorCopyKeepCapacity(dst_list->IdxBuffer, src_list->IdxBuffer);
+            ImVectorCopyKeepCapacity(dst_list->VtxBuffer, src_list->VtxBuffer);
+            ImVectorCopyKeepCapacity(dst_list->RectBuffer, src_list->RectBuffer);
+            ImVectorCopyKeepCapacity(dst_list->_CallbacksDataBuf, src_list->_CallbacksDataBuf);
+        }
+        else
+        {
+            dst_list->CmdBuffer.swap(src_list->CmdBuffer);
+            dst_list->IdxBuffer.swap(src_list->IdxBuffer);
+            dst_list->VtxBuffer.swap(src_list->VtxBuffer);
+            dst_list->RectBuffer.swap(src_list->RectBuffer);
+            dst_list->_CallbacksDataBuf.swap(src_list->_CallbacksDataBuf);
+            src_list->_ResetForNewFrame();
+        }
+        dst_list->Flags = src_list->Flags;
+        dst_list->_OwnerName = src_list->_OwnerName;
+
+        for (ImDrawCmd& cmd : dst_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL && cmd.UserCallbackDataSize > 0)
+                cmd.UserCallbackData = dst_list->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset;
+            if (cmd.TexRef._TexData != NULL && cmd.TexRef._TexData->TexID != ImTextureID_Invalid)
+                cmd.TexRef = ImTextureRef(cmd.TexRef._TexData->TexID);
+        }
+        dst->CmdLists.push_back(dst_list);
+        dst->TotalVtxCount += dst_list->VtxBuffer.Size;
+        dst->TotalIdxCount += dst_list->IdxBuffer.Size;
+        dst->TotalRectCount += dst_list->RectBuffer.Size;
+    }
+    dst->CmdListsCount = dst->CmdLists.Size;
+
+    // Textures requests are processed by the renderer from the snapshot, but ImTextureData instances are still owned by the UI thread.
+    snapshot->Textures.resize(0);
+    if (src->Textures != NULL)
+        for (ImTextureData* tex : *src->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                snapshot->Textures.push_back(tex);
+    dst->Textures = &snapshot->Textures;
 }
 
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
@@ -5939,6 +6616,10 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugCostsEnabled)
+        DebugCostsAddCounters(g, 0, (int)((text_display_end ? text_display_end : text + ImStrlen(text)) - text), 0);
+#endif
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5951,49 +6632,192 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
-// Find window given position, search front-to-back
-// - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
-// - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
-//   with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
-//   called, aka before the next Begin(). Moving window isn't affected.
-// - The 'find_first_and_in_any_viewport = true' mode is only used by TestEngine. It is simpler to maintain here.
-void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window)
+// Hit-test a window from WindowsActiveDisplayOrder[] (without considering other windows)
+static bool IsWindowHitTestingPos(ImGuiWindow* window, const ImVec2& pos, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
 {
-    ImGuiContext& g = *GImGui;
-    ImGuiWindow* hovered_window = NULL;
-    ImGuiWindow* hovered_window_under_moving_window = NULL;
+    IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+    if (!window->WasActive || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
 
-    if (find_first_and_in_any_viewport == false && g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
-        hovered_window = g.MovingWindow;
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+    if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+        return false;
 
-    ImVec2 padding_regular = g.Style.TouchExtraPadding;
-    ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
     {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->WasActive || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            return false;
+    }
+    return true;
+}
 
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
-        if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
-            continue;
+// Build spatial index of windows hit-testing rectangles, so FindHoveredWindowEx() only needs to test windows overlapping a given cell.
+// Called once per frame by EndFrame(). Uses ->Active as windows are tested with ->WasActive during the next frame.
+// We only build it when there are enough windows to make it worthwhile. Otherwise the grid is left invalid and callers do a linear scan.
+void ImGui::UpdateWindowsHitGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    grid->FrameCount = -1;
+    const ImVector<ImGuiWindow*>& windows = g.WindowsActiveDisplayOrder;
+    const ImGuiViewport* viewport = GetMainViewport();
+    if (windows.Size < 16 || viewport->Size.x <= 0.0f || viewport->Size.y <= 0.0f)
+        return;
 
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+    // Grid resolution: aim for 64x64 pixels cells, capped to 64x64 cells.
+    const float cell_size_min = 64.0f;
+    grid->Bounds = ImRect(viewport->Pos, viewport->Pos + viewport->Size);
+    grid->CellsX = ImClamp((int)(viewport->Size.x / cell_size_min), 1, 64);
+    grid->CellsY = ImClamp((int)(viewport->Size.y / cell_size_min), 1, 64);
+    grid->CellSizeInv = ImVec2(grid->CellsX / viewport->Size.x, grid->CellsY / viewport->Size.y);
+
+    // Pass 1: count windows per cell. Pass 2: fill cells, in display order.
+    const ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    const ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    const int cells_count = grid->CellsX * grid->CellsY;
+    grid->CellsOffsets.resize(cells_count + 1);
+    memset(grid->CellsOffsets.Data, 0, (size_t)grid->CellsOffsets.size_in_bytes());
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (ImGuiWindow* window : windows)
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            if (!window->Active || window->Hidden || (window->Flags & ImGuiWindowFlags_NoMouseInputs))
                 continue;
-        }
-
-        if (find_first_and_in_any_viewport)
-        {
+            if (pass == 0)
+            {
+                ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+                ImRect r = window->OuterRectClipped;
+                r.Expand(hit_padding);
+                window->HitGridFrameCount = -1;
+                if (!r.Overlaps(grid->Bounds))
+                    continue;
+                r.ClipWithFull(grid->Bounds);
+                window->HitGridCellMin = ImVec2ih((short)ImMin((int)((r.Min.x - grid->Bounds.Min.x) * grid->CellSizeInv.x), grid->CellsX - 1), (short)ImMin((int)((r.Min.y - grid->Bounds.Min.y) * grid->CellSizeInv.y), grid->CellsY - 1));
+                window->HitGridCellMax = ImVec2ih((short)ImMin((int)((r.Max.x - grid->Bounds.Min.x) * grid->CellSizeInv.x), grid->CellsX - 1), (short)ImMin((int)((r.Max.y - grid->Bounds.Min.y) * grid->CellSizeInv.y), grid->CellsY - 1));
+                window->HitGridFrameCount = g.FrameCount;
+            }
+            else if (window->HitGridFrameCount != g.FrameCount)
+            {
+                continue;
+            }
+            for (int cy = window->HitGridCellMin.y; cy <= window->HitGridCellMax.y; cy++)
+                for (int cx = window->HitGridCellMin.x; cx <= window->HitGridCellMax.x; cx++)
+                {
+                    int* p_cell_offset = &grid->CellsOffsets[cy * grid->CellsX + cx + (pass == 0 ? 1 : 0)];
+                    if (pass == 0)
+                        (*p_cell_offset)++;
+                    else
+                        grid->Windows[(*p_cell_offset)++] = window;
+                }
+        }
+        if (pass == 0)
+        {
+            // Prefix sum. CellsOffsets[n] is used as a write cursor during pass 2, ending up == start offset of cell n+1.
+            for (int cell_n = 0; cell_n < cells_count; cell_n++)
+                grid->CellsOffsets[cell_n + 1] += grid->CellsOffsets[cell_n];
+            grid->Windows.resize(grid->CellsOffsets[cells_count]);
+        }
+    }
+    for (int cell_n = cells_count; cell_n > 0; cell_n--)
+        grid->CellsOffsets[cell_n] = grid->CellsOffsets[cell_n - 1];
+    grid->CellsOffsets[0] = 0;
+    grid->FrameCount = g.FrameCount;
+}
+
+// Move a window to the front or back of every grid cell it overlaps, after it was moved in g.WindowsActiveDisplayOrder[].
+static void UpdateWindowsHitGridDisplayOrder(ImGuiWindow* window, bool to_front)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    if (grid->FrameCount == -1 || window->HitGridFrameCount != grid->FrameCount)
+        return;
+    for (int cy = window->HitGridCellMin.y; cy <= window->HitGridCellMax.y; cy++)
+        for (int cx = window->HitGridCellMin.x; cx <= window->HitGridCellMax.x; cx++)
+        {
+            const int cell_n = cy * grid->CellsX + cx;
+            ImGuiWindow** cell_begin = grid->Windows.Data + grid->CellsOffsets[cell_n];
+            ImGuiWindow** cell_end = grid->Windows.Data + grid->CellsOffsets[cell_n + 1];
+            for (ImGuiWindow** p = cell_begin; p < cell_end; p++)
+                if (*p == window)
+                {
+                    if (to_front)
+                        memmove(p, p + 1, (size_t)(cell_end - p - 1) * sizeof(ImGuiWindow*));
+                    else
+                        memmove(cell_begin + 1, cell_begin, (size_t)(p - cell_begin) * sizeof(ImGuiWindow*));
+                    *(to_front ? cell_end - 1 : cell_begin) = window;
+                    break;
+                }
+        }
+}
+
+// Find windows given position, search front-to-back. This uses the same logic as FindHoveredWindowEx() but doesn't consider g.MovingWindow.
+// Note that this doesn't account for popup/modal blocking: to test for those use IsWindowContentHoverable().
+// Note that candidates come from the hit-testing grid built by last EndFrame(): a window moved during the current frame is found at its previous position.
+int ImGui::FindWindowsAtPos(const ImVec2& pos, ImGuiWindow** out_windows, int out_windows_max)
+{
+    ImGuiContext& g = *GImGui;
+    const ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    const ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    int candidates_count;
+    ImGuiWindow* const* candidates = g.WindowsHitGrid.GetCell(pos, &candidates_count);
+    if (candidates == NULL)
+    {
+        candidates = g.WindowsActiveDisplayOrder.Data;
+        candidates_count = g.WindowsActiveDisplayOrder.Size;
+    }
+    int found_count = 0;
+    for (int n = candidates_count - 1; n >= 0; n--)
+    {
+        ImGuiWindow* window = candidates[n];
+        if (!IsWindowHitTestingPos(window, pos, padding_regular, padding_for_resize))
+            continue;
+        if (found_count < out_windows_max)
+            out_windows[found_count] = window;
+        found_count++;
+    }
+    return found_count;
+}
+
+// Find window given position, search front-to-back
+// - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
+// - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
+//   with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
+//   called, aka before the next Begin(). Moving window isn't affected.
+// - The 'find_first_and_in_any_viewport = true' mode is only used by TestEngine. It is simpler to maintain here.
+void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* hovered_window = NULL;
+    ImGuiWindow* hovered_window_under_moving_window = NULL;
+
+    if (find_first_and_in_any_viewport == false && g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
+        hovered_window = g.MovingWindow;
+
+    // Only test windows overlapping the grid cell containing 'pos' (or all windows if the grid is not available)
+    ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    int candidates_count;
+    ImGuiWindow* const* candidates = g.WindowsHitGrid.GetCell(pos, &candidates_count);
+    if (candidates == NULL)
+    {
+        candidates = g.WindowsActiveDisplayOrder.Data;
+        candidates_count = g.WindowsActiveDisplayOrder.Size;
+    }
+    for (int n = candidates_count - 1; n >= 0; n--)
+    {
+        ImGuiWindow* window = candidates[n];
+        if (!IsWindowHitTestingPos(window, pos, padding_regular, padding_for_resize))
+            continue;
+
+        if (find_first_and_in_any_viewport)
+        {
             hovered_window = window;
             break;
         }
@@ -6435,6 +7259,26 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 
     InitOrLoadWindowSettings(window, settings);
 
+    // Restore state of a window previously destroyed by GcHibernateWindowList()
+    if (ImGuiWindowHibernateData* data = g.WindowsHibernated.GetByKey(window->ID))
+    {
+        SetWindowConditionAllowFlags(window, ImGuiCond_FirstUseEver, false);
+        window->Pos = data->Pos;
+        window->Size = window->SizeFull = data->SizeFull;
+        window->Collapsed = data->Collapsed;
+        window->Scroll = data->Scroll;
+        window->StateStorage.Data.swap(data->StateStorage.Data);
+        window->ColumnsStorage.swap(data->ColumnsStorage);
+        window->DC.CursorStartPos = window->DC.CursorMaxPos = window->DC.IdealMaxPos = window->Pos;
+        if ((flags & ImGuiWindowFlags_AlwaysAutoResize) == 0)
+        {
+            window->AutoFitFramesX = (window->Size.x <= 0.0f) ? 2 : -1;
+            window->AutoFitFramesY = (window->Size.y <= 0.0f) ? 2 : -1;
+            window->AutoFitOnlyGrows = (window->AutoFitFramesX > 0) || (window->AutoFitFramesY > 0);
+        }
+        g.WindowsHibernated.Remove(window->ID, data);
+    }
+
     if (flags & ImGuiWindowFlags_NoBringToFrontOnFocus)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
@@ -6748,7 +7592,10 @@ static int ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& si
         ButtonBehavior(border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawList(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
         if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        {
+            RequestWakeup(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
             hovered = false;
+        }
         if (hovered || held)
             SetMouseCursor((axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS);
         if (held && g.IO.MouseDoubleClicked[0])
@@ -7122,39 +7969,140 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
-// [EXPERIMENTAL] Called by Begin(). NextWindowData is valid at this point.
-// This is designed as a toy/test-bed for
+// Hash all state that previously drawn contents of a window depend on, besides the user's own data.
+static ImGuiID CalcWindowRefreshStateHash(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.WindowsRefreshStyleHash == 0 || memcmp(&g.Style, &g.WindowsRefreshStyleBackup, sizeof(g.Style)) != 0)
+    {
+        g.WindowsRefreshStyleBackup = g.Style;
+        g.WindowsRefreshStyleHash = ImHashData(&g.Style, sizeof(g.Style));
+    }
+    ImGuiID hash = g.WindowsRefreshStyleHash;
+    ImVec2 content_size, content_size_ideal; // Content size as measured during last refresh, which will differ from ContentSize until layout is stable.
+    CalcWindowContentSizes(window, &content_size, &content_size_ideal);
+    const float window_state[12] = { window->Pos.x, window->Pos.y, window->SizeFull.x, window->SizeFull.y, window->Scroll.x, window->Scroll.y, content_size.x, content_size.y, content_size_ideal.x, content_size_ideal.y, window->FontWindowScale, (g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasBgAlpha) ? g.NextWindowData.BgAlphaVal : -1.0f };
+    hash = ImHashData(window_state, sizeof(window_state), hash);
+    const ImFontAtlas* atlas = g.Font ? g.Font->ContainerAtlas : NULL;
+    const int misc_state[5] = { (int)window->Flags, (int)window->Collapsed, (atlas && atlas->TexData) ? atlas->TexData->UniqueID : 0, (g.NavWindow && g.NavWindow->RootWindowForTitleBarHighlight == window->RootWindowForTitleBarHighlight) ? 1 : 0, (int)(g.FontSize * 64.0f) };
+    hash = ImHashData(misc_state, sizeof(misc_state), hash);
+    hash = ImHashData(&g.Font, sizeof(g.Font), hash);
+    return hash;
+}
+
+// Return true if 'other_window' (e.g. hovered or focused window) is within the same root window or was submitted from within 'window'.
+static bool IsWindowRelatedForRefresh(ImGuiWindow* window, ImGuiWindow* other_window)
+{
+    return other_window && (window->RootWindow == other_window->RootWindow || ImGui::IsWindowWithinBeginStackOf(other_window->RootWindow, window));
+}
+
+// Return true if inputs this frame may interact with the window contents, in which case items need to be submitted.
+static bool IsWindowRefreshRequiredByInputs(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    bool mouse_events = ImGui::IsAnyMouseDown() || g.IO.MouseDelta.x != 0.0f || g.IO.MouseDelta.y != 0.0f;
+    bool keyboard_events = false;
+    for (const ImGuiInputEvent& e : g.InputEventsTrail)
+    {
+        mouse_events |= (e.Type == ImGuiInputEventType_MousePos || e.Type == ImGuiInputEventType_MouseWheel || e.Type == ImGuiInputEventType_MouseButton);
+        keyboard_events |= (e.Type == ImGuiInputEventType_Key || e.Type == ImGuiInputEventType_Text);
+    }
+
+    // Mouse inputs while the mouse is or was over the window, including its resize borders
+    if (mouse_events)
+    {
+        ImRect window_rect = window->Rect();
+        window_rect.Expand(g.WindowsBorderHoverPadding);
+        if (window_rect.Contains(g.IO.MousePos) || window_rect.Contains(g.IO.MousePosPrev))
+            return true;
+    }
+
+    // Hovered item (for hover delays and tooltips), active item, moving window
+    if (g.HoveredIdPreviousFrame != 0 && IsWindowRelatedForRefresh(window, g.HoveredWindow))
+        return true;
+    if (g.ActiveId != 0 && IsWindowRelatedForRefresh(window, g.ActiveIdWindow))
+        return true;
+    if (IsWindowRelatedForRefresh(window, g.MovingWindow) || IsWindowRelatedForRefresh(window, g.NavWindowingTarget))
+        return true;
+
+    // Keyboard/gamepad inputs and navigation requests while focused, item released on previous frame
+    if (IsWindowRelatedForRefresh(window, g.NavWindow))
+    {
+        if (keyboard_events || g.NavAnyRequest || g.ActiveIdPreviousFrame != 0)
+            return true;
+        for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_Mouse_BEGIN; key = (ImGuiKey)(key + 1))
+            if (ImGui::GetKeyData(key)->Down) // Key repeat
+                return true;
+    }
+    return false;
+}
+
+// Called by Begin(). NextWindowData is valid at this point.
+// With ImGuiWindowRefreshFlags_TryToAvoidRefresh, the window reuses its previously drawn contents and Begin() returns false, until:
+// - the window is appearing or was hidden.
+// - any state its contents depend on changed: style, font, atlas texture, position, size, scroll, collapsed state, focus (see CalcWindowRefreshStateHash()).
+// - MarkWindowDirty() was called for the window or one of its child windows.
+// - refresh policy flags request it: ImGuiWindowRefreshFlags_RefreshOnHover, ImGuiWindowRefreshFlags_RefreshOnFocus, ImGuiWindowRefreshFlags_RefreshOnInput.
+// Window-level hit-testing keeps working using rectangles from the last refresh. Items hit-testing, navigation and tooltips require
+// items to be submitted: ImGuiWindowRefreshFlags_RefreshOnInput refreshes whenever inputs may interact with the window contents.
 void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
     window->SkipRefresh = false;
     if ((g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy) == 0)
         return;
-    if (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
-    {
-        // FIXME-IDLE: Tests for e.g. mouse clicks or keyboard while focused.
-        if (window->Appearing) // If currently appearing
-            return;
-        if (window->Hidden) // If was hidden (previous frame)
+    const ImGuiWindowRefreshFlags refresh_flags = g.NextWindowData.RefreshFlagsVal;
+    if (refresh_flags & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
+    {
+        const ImGuiID prev_state_hash = window->RefreshStateHash;
+        window->RefreshStateHash = CalcWindowRefreshStateHash(window);
+
+        bool need_refresh = false;
+        need_refresh |= window->Appearing;  // If currently appearing
+        need_refresh |= window->Hidden;     // If was hidden (previous frame)
+        need_refresh |= window->RefreshDirty || window->RefreshStateHash != prev_state_hash;
+        need_refresh |= window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX;
+        if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnHover) && IsWindowRelatedForRefresh(window, g.HoveredWindow))
+            need_refresh = true;
+        if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnFocus) && IsWindowRelatedForRefresh(window, g.NavWindow))
+            need_refresh = true;
+        if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnInput) && !need_refresh)
+            need_refresh = IsWindowRefreshRequiredByInputs(window);
+        if (need_refresh)
+        {
+            window->RefreshDirty = false;
             return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
-            if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
-                return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
-            if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
-                return;
+        }
         window->DrawList = NULL;
         window->SkipRefresh = true;
     }
 }
 
+// Contents of a window using ImGuiWindowRefreshFlags_TryToAvoidRefresh, or of a child of such window, may be displayed again next frame.
+static void UpdateWindowDrawListRetained(ImGuiWindow* window)
+{
+    ImGuiWindow* parent_window = (window->Flags & ImGuiWindowFlags_ChildWindow) ? window->ParentWindow : NULL;
+    window->DrawListInst._RetainedForNextFrame = window->SkipRefresh || window->RefreshStateHash != 0 || (parent_window && parent_window->DrawListInst._RetainedForNextFrame);
+}
+
+static void AddWindowToRecentlyActiveList(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->InRecentlyActiveList)
+        return;
+    g.WindowsRecentlyActive.push_back(window);
+    window->InRecentlyActiveList = true;
+}
+
 static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
 {
     window->Active = true;
     for (ImGuiWindow* child : window->DC.ChildWindows)
         if (!child->Hidden)
         {
+            AddWindowToRecentlyActiveList(child);
             child->Active = child->SkipRefresh = true;
+            child->DrawListInst._RetainedForNextFrame = true;
             SetWindowActiveForSkipRefresh(child);
         }
 }
@@ -7179,6 +8127,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
+    IMGUI_PROFILER_ZONE_ID("Begin", window->ID);
 
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInWindow == window->ID)
@@ -7214,6 +8163,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->LastTimeActive = (float)g.Time;
         window->BeginOrderWithinParent = 0;
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
+        AddWindowToRecentlyActiveList(window);
     }
     else
     {
@@ -7230,6 +8180,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->IDStack.push_back(window->ID);
 
     // Add to stack
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugCostsEnabled)
+        DebugCostsSetCurrentWindow(g, window);
+#endif
     g.CurrentWindow = window;
     g.CurrentWindowStack.resize(g.CurrentWindowStack.Size + 1);
     ImGuiWindowStackData& window_stack_data = g.CurrentWindowStack.back();
@@ -7326,6 +8280,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
     // [EXPERIMENTAL] Skip Refresh mode
     UpdateWindowSkipRefresh(window);
+    if (first_begin_of_the_frame)
+        UpdateWindowDrawListRetained(window);
 
     // Nested root windows (typically tooltips) override disabled state
     if (window_stack_data.DisabledOverrideReenable && window->RootWindow == window)
@@ -7702,7 +8658,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // DRAWING
 
         // Setup draw list and outer clipping rectangle
-        IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
+        IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0 && window->DrawList->CmdBuffer[0].RectCount == 0);
         window->DrawList->PushTexture(g.Font->ContainerAtlas->TexRef);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
@@ -7717,8 +8673,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0);
-                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && !parent_is_empty && !previous_child_overlapping)
+                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0 && parent_window->DrawList->RectBuffer.Size == 0);
+                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && window->DrawList->CmdBuffer.back().RectCount == 0 && !parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
             if (render_decorations_in_parent)
@@ -7953,6 +8909,7 @@ void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_PROFILER_ZONE_ID("End", window->ID);
 
     // Error checking: verify that user hasn't called End() too many times!
     if (g.CurrentWindowStack.Size <= 1 && g.WithinFrameScopeWithImplicitWindow)
@@ -8218,7 +9175,10 @@ bool ImGui::IsWindowHovered(ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags = ApplyHoverFlagsForTooltip(flags, g.Style.HoverFlagsForTooltipMouse);
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        RequestWakeup(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
         return false;
+    }
 
     return true;
 }
@@ -8436,7 +9396,14 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
-// This is experimental and meant to be a toy for exploring a future/wider range of features.
+// Use ImGuiWindowRefreshFlags_Retained to reuse contents of mostly static windows until MarkWindowDirty() is called. See UpdateWindowSkipRefresh().
+// Usage:
+//   ImGui::SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags_Retained);
+//   if (ImGui::Begin("Panel")) // Return false when reusing previous contents: don't submit anything!
+//       { ... }
+//   ImGui::End();
+//   [...]
+//   ImGui::MarkWindowDirty("Panel"); // When data displayed in the window changed
 void ImGui::SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags)
 {
     ImGuiContext& g = *GImGui;
@@ -8444,6 +9411,18 @@ void ImGui::SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags)
     g.NextWindowData.RefreshFlagsVal = flags;
 }
 
+// Parent windows are also marked, as they submit their child windows.
+void ImGui::MarkWindowDirty(ImGuiID window_id)
+{
+    for (ImGuiWindow* window = FindWindowByID(window_id); window != NULL; window = window->ParentWindow)
+        window->RefreshDirty = true;
+}
+
+void ImGui::MarkWindowDirty(const char* name)
+{
+    MarkWindowDirty(ImHashStr(name));
+}
+
 ImDrawList* ImGui::GetWindowDrawList()
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -8662,11 +9641,14 @@ static void ImGui::UpdateTexturesNewFrame()
 {
     // Cannot update every atlases based on atlas's FrameCount < g.FrameCount, because an atlas may be shared by multiple contexts with different frame count.
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateTexturesNewFrame");
     const bool has_textures = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) != 0;
     for (ImFontAtlas* atlas : g.FontAtlases)
     {
         if (atlas->OwnerContext == &g)
         {
+            // An atlas shared with contexts updated from other threads needs to be updated by you while no context is within a frame (see ImFontAtlas::LockFunc)
+            IM_ASSERT(atlas->LockFunc == NULL && "An atlas with a LockFunc cannot be owned by a context!");
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
         }
         else
@@ -8691,7 +9673,9 @@ static void ImGui::UpdateTexturesEndFrame()
         {
             // We provide this information so backends can decide whether to destroy textures.
             // This means in practice that if N imgui contexts are created with a shared atlas, we assume all of them have a backend initialized.
-            tex->RefCount = (unsigned short)atlas->RefCount;
+            // Only write on change, as the atlas may be shared with contexts on other threads.
+            if (tex->RefCount != (unsigned short)atlas->RefCount)
+                tex->RefCount = (unsigned short)atlas->RefCount;
             g.PlatformIO.Textures.push_back(tex);
         }
     for (ImTextureData* tex : g.UserTextures)
@@ -8701,9 +9685,11 @@ static void ImGui::UpdateTexturesEndFrame()
 void ImGui::UpdateFontsNewFrame()
 {
     ImGuiContext& g = *GImGui;
+    // Atlases with a LockFunc may be used by contexts on other threads: we don't toggle their Locked field, set it yourself if needed.
     if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
         for (ImFontAtlas* atlas : g.FontAtlases)
-            atlas->Locked = true;
+            if (atlas->LockFunc == NULL)
+                atlas->Locked = true;
 
     if (g.Style._NextFrameFontSizeBase != 0.0f)
     {
@@ -8761,18 +9747,26 @@ void ImGui::RegisterFontAtlas(ImFontAtlas* atlas)
     ImGuiContext& g = *GImGui;
     if (g.FontAtlases.Size == 0)
         IM_ASSERT(atlas == g.IO.Fonts);
+    if (atlas->LockFunc)
+        ImFontAtlasLockForWrite(atlas);
     atlas->RefCount++;
     g.FontAtlases.push_back(atlas);
     ImFontAtlasAddDrawListSharedData(atlas, &g.DrawListSharedData);
+    if (atlas->LockFunc)
+        ImFontAtlasUnlockForWrite(atlas);
 }
 
 void ImGui::UnregisterFontAtlas(ImFontAtlas* atlas)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(atlas->RefCount > 0);
+    if (atlas->LockFunc)
+        ImFontAtlasLockForWrite(atlas);
     ImFontAtlasRemoveDrawListSharedData(atlas, &g.DrawListSharedData);
     g.FontAtlases.find_erase(atlas);
     atlas->RefCount--;
+    if (atlas->LockFunc)
+        ImFontAtlasUnlockForWrite(atlas);
 }
 
 // Use ImDrawList::_SetTexture(), making our shared g.FontStack[] authoritative against window-local ImDrawList.
@@ -8799,7 +9793,8 @@ void ImGui::SetCurrentFont(ImFont* font, float font_size_before_scaling, float f
         ImFontAtlas* atlas = font->ContainerAtlas;
         g.DrawListSharedData.FontAtlas = atlas;
         g.DrawListSharedData.Font = font;
-        ImFontAtlasUpdateDrawListsSharedData(atlas);
+        g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel; // Only update our own shared data, the atlas may be shared with contexts on other threads.
+        g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
         if (g.CurrentWindow != NULL)
             g.CurrentWindow->DrawList->_SetTexture(atlas->TexRef);
     }
@@ -8846,7 +9841,7 @@ void ImGui::UpdateCurrentFontSize(float restore_font_size_after_scaling)
     // - We may support it better later and remove this rounding.
     final_size = GetRoundedFontSize(final_size);
     final_size = ImClamp(final_size, 1.0f, IMGUI_FONT_SIZE_MAX);
-    if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
+    if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) && g.Font->CurrentRasterizerDensity != g.FontRasterizerDensity)
         g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
     g.FontSize = final_size;
     g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
@@ -10175,6 +11170,7 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_ZONE("UpdateInputEvents");
 
     // Only trickle chars<>key when working with InputText()
     // FIXME: InputText() could parse event trail?
@@ -11004,6 +12000,11 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
     g.NextItemData.HasFlags = ImGuiNextItemDataFlags_None;
     g.NextItemData.ItemFlags = ImGuiItemFlags_None;
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugCostsEnabled)
+        DebugCostsAddCounters(g, 1, 0, 0);
+#endif
+
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     if (id != 0)
         IMGUI_TEST_ENGINE_ITEM_ADD(id, g.LastItemData.NavRect, &g.LastItemData);
@@ -12589,6 +13590,11 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
             g.Windows[g.Windows.Size - 1] = window;
             break;
         }
+    if (g.WindowsActiveDisplayOrder.find_erase(window))
+    {
+        g.WindowsActiveDisplayOrder.push_back(window);
+        UpdateWindowsHitGridDisplayOrder(window, true);
+    }
 }
 
 void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
@@ -12603,6 +13609,11 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
             g.Windows[0] = window;
             break;
         }
+    if (g.WindowsActiveDisplayOrder.find_erase(window))
+    {
+        g.WindowsActiveDisplayOrder.push_front(window);
+        UpdateWindowsHitGridDisplayOrder(window, false);
+    }
 }
 
 void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_window)
@@ -12625,6 +13636,13 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
     }
+
+    // Rebuild active display order (rare)
+    g.WindowsHitGrid.Invalidate();
+    g.WindowsActiveDisplayOrder.resize(0);
+    for (ImGuiWindow* w : g.Windows)
+        if (w->Active || w->WasActive)
+            g.WindowsActiveDisplayOrder.push_back(w);
 }
 
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
@@ -13394,6 +14412,7 @@ static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_ZONE("NavUpdate");
 
     io.WantSetMousePos = false;
     //if (g.NavScoringDebugCount > 0) IMGUI_DEBUG_LOG_NAV("[nav] NavScoringDebugCount %d for '%s' layer %d (Init:%d, Move:%d)\n", g.NavScoringDebugCount, g.NavWindow ? g.NavWindow->Name : "NULL", g.NavLayer, g.NavInitRequest || g.NavInitResultId != 0, g.NavMoveRequest);
@@ -14740,6 +15759,158 @@ void ImGui::EndDragDropTarget()
         ClearDragDrop();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] SUB-CONTEXTS
+//-----------------------------------------------------------------------------
+// A sub-context is a regular ImGuiContext whose output is composited into a region of a host window.
+// It may be updated concurrently on another thread (see IMGUI_USE_THREAD_LOCAL_CONTEXT and ImFontAtlas::LockFunc to share the font atlas).
+//-----------------------------------------------------------------------------
+// - SubContextRouteInputs() [Internal]
+// - SubContextView()
+//-----------------------------------------------------------------------------
+
+// Replay inputs processed by the host context this frame into the child context, relative to 'origin'.
+// - Releases are always forwarded so child buttons/keys can't get stuck.
+// - Events in the trail already had io.ConfigMacOSXBehaviors applied by the host: undo it as the child will apply it again.
+static void SubContextRouteInputs(ImGuiContext* child_ctx, const ImVec2& origin, bool route_mouse, bool route_keyboard)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& child_io = child_ctx->IO;
+    for (const ImGuiInputEvent& e : g.InputEventsTrail)
+    {
+        if (e.Type == ImGuiInputEventType_MousePos && route_mouse)
+        {
+            child_io.AddMouseSourceEvent(e.MousePos.MouseSource);
+            if (e.MousePos.PosX == -FLT_MAX)
+                child_io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+            else
+                child_io.AddMousePosEvent(e.MousePos.PosX - origin.x, e.MousePos.PosY - origin.y);
+        }
+        else if (e.Type == ImGuiInputEventType_MouseWheel && route_mouse)
+        {
+            child_io.AddMouseSourceEvent(e.MouseWheel.MouseSource);
+            child_io.AddMouseWheelEvent(e.MouseWheel.WheelX, e.MouseWheel.WheelY);
+        }
+        else if (e.Type == ImGuiInputEventType_MouseButton && (route_mouse || !e.MouseButton.Down))
+        {
+            child_io.AddMouseSourceEvent(e.MouseButton.MouseSource);
+            child_io.AddMouseButtonEvent(e.MouseButton.Button, e.MouseButton.Down);
+        }
+        else if (e.Type == ImGuiInputEventType_Key && (route_keyboard || !e.Key.Down))
+        {
+            ImGuiKey key = e.Key.Key;
+            if (g.IO.ConfigMacOSXBehaviors && child_io.ConfigMacOSXBehaviors)
+            {
+                if (key == ImGuiMod_Super)          { key = ImGuiMod_Ctrl; }
+                else if (key == ImGuiMod_Ctrl)      { key = ImGuiMod_Super; }
+                else if (key == ImGuiKey_LeftSuper) { key = ImGuiKey_LeftCtrl; }
+                else if (key == ImGuiKey_RightSuper){ key = ImGuiKey_RightCtrl; }
+                else if (key == ImGuiKey_LeftCtrl)  { key = ImGuiKey_LeftSuper; }
+                else if (key == ImGuiKey_RightCtrl) { key = ImGuiKey_RightSuper; }
+            }
+            child_io.AddKeyAnalogEvent(key, e.Key.Down, e.Key.AnalogValue);
+        }
+        else if (e.Type == ImGuiInputEventType_Text && route_keyboard)
+        {
+            child_io.AddInputCharacter(e.Text.Char);
+        }
+        else if (e.Type == ImGuiInputEventType_Focus)
+        {
+            child_io.AddFocusEvent(e.AppFocused.Focused);
+        }
+    }
+
+    // Submit current position (filtered when unchanged), as the region may have moved, or the mouse may have entered/left it without moving.
+    if (route_mouse && ImGui::IsMousePosValid(&g.IO.MousePos))
+        child_io.AddMousePosEvent(g.IO.MousePos.x - origin.x, g.IO.MousePos.y - origin.y);
+    else if (!route_mouse)
+        child_io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+}
+
+// Composite the last draw data rendered by 'child_ctx' into a region of the current window, and route inputs to 'child_ctx' for its next frame.
+// - 'child_ctx' is read and written to: call this while it is not within its NewFrame()..Render() (e.g. after joining its worker thread).
+// - The child context is given io.DisplaySize == region size. Clicking the region gives it keyboard focus, until clicking elsewhere.
+// - Textures are referenced as-is: the child context needs to use the same font atlas and renderer backend flags as the host.
+bool ImGui::SubContextView(const char* str_id, ImGuiContext* child_ctx, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    IM_ASSERT(child_ctx != NULL && child_ctx != &g);
+    if (window->SkipItems)
+    {
+        SubContextRouteInputs(child_ctx, window->DC.CursorPos, false, false); // Forward releases (e.g. host window collapsed while a child button or key is held)
+        return false;
+    }
+
+    const ImGuiID id = window->GetID(str_id);
+    const ImVec2 avail = GetContentRegionAvail();
+    const ImVec2 size = ImTrunc(CalcItemSize(size_arg, avail.x, avail.y));
+    const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + size);
+    ItemSize(size);
+    child_ctx->IO.DisplaySize = ImMax(size, ImVec2(0.0f, 0.0f));
+    if (!ItemAdd(bb, id, NULL, ImGuiItemFlags_NoNav))
+    {
+        SubContextRouteInputs(child_ctx, bb.Min, false, false);
+        return false;
+    }
+
+    // Behavior: clicking gives focus (similar to InputText()), the child context then receives all keyboard inputs.
+    const bool hovered = ItemHoverable(bb, id, g.LastItemData.ItemFlags);
+    bool clicked = false, held = false;
+    for (int mouse_button = 0; mouse_button < ImGuiMouseButton_COUNT; mouse_button++)
+    {
+        clicked |= g.IO.MouseClicked[mouse_button];
+        held |= g.IO.MouseDown[mouse_button];
+    }
+    if (hovered && clicked && g.ActiveId != id)
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+    }
+    else if (g.ActiveId == id && clicked && !hovered)
+    {
+        ClearActiveID();
+    }
+    const bool focused = (g.ActiveId == id);
+    if (focused)
+        SetActiveIdUsingAllKeyboardKeys();
+    if (hovered)
+    {
+        SetItemKeyOwner(ImGuiKey_MouseWheelX);
+        SetItemKeyOwner(ImGuiKey_MouseWheelY);
+    }
+    const bool mouse_held = (focused && held);
+    SubContextRouteInputs(child_ctx, bb.Min, hovered || mouse_held, focused);
+
+    // Forward child outputs
+    if (hovered || mouse_held)
+        SetMouseCursor(child_ctx->MouseCursor);
+    if (focused && child_ctx->PlatformImeData.WantVisible)
+    {
+        g.PlatformImeData = child_ctx->PlatformImeData;
+        g.PlatformImeData.InputPos += bb.Min;
+        g.PlatformImeData.ViewportId = window->Viewport->ID;
+    }
+    else if (focused && child_ctx->PlatformImeData.WantTextInput)
+    {
+        g.PlatformImeData.WantTextInput = true;
+    }
+    RequestWakeup(child_ctx->IO.NextWakeupDelay);
+
+    // Composite
+    ImDrawData* child_draw_data = &child_ctx->Viewports[0]->DrawDataP;
+    if (child_draw_data->Valid)
+    {
+        ImDrawList* draw_list = window->DrawList;
+        draw_list->PushClipRect(bb.Min, bb.Max, true);
+        for (ImDrawList* child_draw_list : child_draw_data->CmdLists)
+            draw_list->AddDrawList(child_draw_list, bb.Min - child_draw_data->DisplayPos);
+        draw_list->PopClipRect();
+    }
+    return focused;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] LOGGING/CAPTURING
 //-----------------------------------------------------------------------------
@@ -15012,6 +16183,7 @@ void ImGui::UpdateSettings()
 {
     // Load settings on first frame (if not explicitly loaded manually before)
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateSettings");
     if (!g.SettingsLoaded)
     {
         IM_ASSERT(g.SettingsWindows.empty());
@@ -15167,6 +16339,22 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             handler.ApplyAllFn(&g, &handler);
 }
 
+// Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// (shared by SaveIniSettingsToDisk() and SaveIniSettingsToMemory(), which each record a single ImGuiDebugHitchEventType_IniSave event)
+static const char* SaveIniSettingsToMemoryNoHitchEvent(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("SaveIniSettingsToMemory");
+    g.SettingsDirtyTimer = 0.0f;
+    g.SettingsIniData.Buf.resize(0);
+    g.SettingsIniData.Buf.push_back(0);
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+    if (out_size)
+        *out_size = (size_t)g.SettingsIniData.size();
+    return g.SettingsIniData.c_str();
+}
+
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
@@ -15174,8 +16362,9 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     if (!ini_filename)
         return;
 
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_IniSave);
     size_t ini_data_size = 0;
-    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+    const char* ini_data = SaveIniSettingsToMemoryNoHitchEvent(&ini_data_size);
     ImFileHandle f = ImFileOpen(ini_filename, "wt");
     if (!f)
         return;
@@ -15183,18 +16372,10 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     ImFileClose(f);
 }
 
-// Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
-    ImGuiContext& g = *GImGui;
-    g.SettingsDirtyTimer = 0.0f;
-    g.SettingsIniData.Buf.resize(0);
-    g.SettingsIniData.Buf.push_back(0);
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
-    if (out_size)
-        *out_size = (size_t)g.SettingsIniData.size();
-    return g.SettingsIniData.c_str();
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_IniSave);
+    return SaveIniSettingsToMemoryNoHitchEvent(out_size);
 }
 
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
@@ -15662,6 +16843,311 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// Compiled with IMGUI_ENABLE_PROFILER. See IMGUI_PROFILER_ZONE() macros in imgui_internal.h.
+//-----------------------------------------------------------------------------
+// - ImGuiProfilerZoneScope [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+// - ProfilerClear() [Internal]
+// - ProfilerExportChromeTrace() [Internal]
+// - ProfilerSaveChromeTrace() [Internal]
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+static void ProfilerZoneBeginEx(ImGuiContext* ctx, const char* name, ImGuiID id)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const int depth = profiler->ZonesStackSize++;
+    if (depth >= IM_ARRAYSIZE(profiler->ZonesStack))
+        return;
+    if (profiler->Zones.Size != profiler->ZonesCapacity)
+    {
+        // Allocate on first use, or reallocate after capacity change (previous zones are lost, open zones are ignored when ending)
+        IM_ASSERT(profiler->ZonesCapacity > 0);
+        profiler->Zones.resize(profiler->ZonesCapacity);
+        profiler->ZonesWritten += (ImU64)profiler->ZonesCapacity;
+    }
+    const ImU64 zone_idx = profiler->ZonesWritten++;
+    ImGuiProfilerZone* zone = &profiler->Zones[(int)(zone_idx % (ImU64)profiler->Zones.Size)];
+    zone->Name = name;
+    zone->ID = id;
+    zone->FrameCount = g.FrameCount;
+    zone->Depth = depth;
+    zone->TimeEnd = 0;
+    profiler->ZonesStack[depth] = zone_idx;
+    if (g.Hooks.Size > 0)
+    {
+        profiler->HookZone = zone;
+        ImGui::CallContextHooks(&g, ImGuiContextHookType_ProfilerZoneBegin);
+        profiler->HookZone = NULL;
+    }
+    zone->TimeBegin = ImTimeGetNs(); // Last, so hooks are not included
+}
+
+static void ProfilerZoneEndEx(ImGuiContext* ctx)
+{
+    const ImU64 time_end = ImTimeGetNs();
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.Profiler;
+    IM_ASSERT(profiler->ZonesStackSize > 0 && "Mismatched ProfilerZoneBegin()/ProfilerZoneEnd() calls!");
+    const int depth = --profiler->ZonesStackSize;
+    if (depth >= IM_ARRAYSIZE(profiler->ZonesStack))
+        return;
+    const ImU64 zone_idx = profiler->ZonesStack[depth];
+    if (profiler->ZonesWritten - zone_idx > (ImU64)profiler->Zones.Size) // Overwritten by inner zones, or buffer reallocated
+        return;
+    ImGuiProfilerZone* zone = &profiler->Zones[(int)(zone_idx % (ImU64)profiler->Zones.Size)];
+    zone->TimeEnd = ImMax(time_end, zone->TimeBegin + 1);
+    zone->FrameCount = g.FrameCount; // Tag with frame at the end of the zone, so NewFrame() belongs to the frame it starts.
+    if (g.Hooks.Size > 0)
+    {
+        profiler->HookZone = zone;
+        ImGui::CallContextHooks(&g, ImGuiContextHookType_ProfilerZoneEnd);
+        profiler->HookZone = NULL;
+    }
+}
+
+ImGuiProfilerZoneScope::ImGuiProfilerZoneScope(const char* name, ImGuiID id)
+{
+    Ctx = GImGui;
+    if (Ctx != NULL && !Ctx->Profiler.Enabled)
+        Ctx = NULL;
+    if (Ctx != NULL)
+        ProfilerZoneBeginEx(Ctx, name, id);
+}
+
+ImGuiProfilerZoneScope::~ImGuiProfilerZoneScope()
+{
+    if (Ctx != NULL)
+        ProfilerZoneEndEx(Ctx);
+}
+
+// Manual zones are always recorded, regardless of g.Profiler.Enabled.
+void ImGui::ProfilerZoneBegin(const char* name, ImGuiID id)
+{
+    ProfilerZoneBeginEx(GImGui, name, id);
+}
+
+void ImGui::ProfilerZoneEnd()
+{
+    ProfilerZoneEndEx(GImGui);
+}
+
+void ImGui::ProfilerClear()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    profiler->ZonesWritten += (ImU64)profiler->Zones.Size; // Open zones will be ignored when ending
+    for (ImGuiProfilerZone& zone : profiler->Zones)
+        zone.TimeEnd = 0;
+}
+
+// Return a display name for the window/table ID associated to a zone
+static const char* ProfilerGetZoneIDName(ImGuiID id)
+{
+    if (id == 0)
+        return NULL;
+    if (ImGuiWindow* window = ImGui::FindWindowByID(id))
+        return window->Name;
+    if (ImGuiTable* table = ImGui::TableFindByID(id))
+        return table->OuterWindow ? table->OuterWindow->Name : NULL;
+    return NULL;
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Export completed zones in Chrome trace event format (JSON Object Format with "X" complete events).
+// Open in chrome://tracing or https://ui.perfetto.dev. Timestamps are absolute, so traces from multiple contexts can be merged.
+void ImGui::ProfilerExportChromeTrace(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const ImGuiContext* ctx = &g;
+    const unsigned int tid = ImHashData(&ctx, sizeof(ctx)) & 0x7FFFFFFF;
+    buf->append("{\"traceEvents\":[\n");
+    buf->appendf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Dear ImGui context %p\"}}", tid, (void*)&g);
+    const ImU64 zones_count = ImMin(profiler->ZonesWritten, (ImU64)profiler->Zones.Size);
+    for (ImU64 zone_idx = profiler->ZonesWritten - zones_count; zone_idx < profiler->ZonesWritten; zone_idx++)
+    {
+        const ImGuiProfilerZone* zone = &profiler->Zones[(int)(zone_idx % (ImU64)profiler->Zones.Size)];
+        if (zone->TimeEnd == 0)
+            continue;
+        buf->append(",\n{\"name\":");
+        ProfilerAppendJsonString(buf, zone->Name);
+        buf->appendf(",\"cat\":\"imgui\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d", tid, zone->TimeBegin / 1000.0, (zone->TimeEnd - zone->TimeBegin) / 1000.0, zone->FrameCount);
+        if (const char* id_name = ProfilerGetZoneIDName(zone->ID))
+        {
+            buf->append(",\"id\":");
+            ProfilerAppendJsonString(buf, id_name);
+        }
+        buf->append("}}");
+    }
+    buf->append("\n]}\n");
+}
+
+bool ImGui::ProfilerSaveChromeTrace(const char* filename)
+{
+    ImGuiTextBuffer buf;
+    ProfilerExportChromeTrace(&buf);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
+//-----------------------------------------------------------------------------
+// [SECTION] HITCH RECORDER
+//-----------------------------------------------------------------------------
+// See ImGuiDebugHitchRecorder and IMGUI_DEBUG_HITCH_EVENT() macro in imgui_internal.h.
+//-----------------------------------------------------------------------------
+// - ImGuiDebugHitchEventScope [Internal]
+// - DebugHitchesNewFrame() [Internal]
+// - DebugHitchesEndFrame() [Internal]
+// - DebugHitchesSubmitFrame() [Internal]
+// - DebugHitchesClear() [Internal]
+// - DebugHitchesExport() [Internal]
+// - DebugHitchesSave() [Internal]
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+
+static const char* GDebugHitchEventTypeNames[] = { "GlyphLoad", "TextureGrow", "TextureRepack", "IniSave", "GcCompact", "LargeAlloc" };
+IM_STATIC_ASSERT(IM_ARRAYSIZE(GDebugHitchEventTypeNames) == ImGuiDebugHitchEventType_COUNT);
+
+static void DebugHitchesAddEvent(ImGuiContext* ctx, ImGuiDebugHitchEventType type, ImU64 time)
+{
+    ImGuiDebugHitchRecorder* recorder = &ctx->DebugHitchRecorder;
+    ImGuiDebugHitchEventStats* stats = &recorder->FrameEvents[type];
+    stats->Count++;
+    stats->TotalTime += time;
+    stats->MaxTime = ImMax(stats->MaxTime, time);
+    if (recorder->FrameTimeEnd != 0 && recorder->EventsDepth == 0) // Outermost event after end of frame: add to frame time
+        recorder->FrameTimeAfterEnd += time;
+}
+
+// Events are recorded in the current context, if any (e.g. font atlas functions may be called without a context)
+ImGuiDebugHitchEventScope::ImGuiDebugHitchEventScope(ImGuiDebugHitchEventType type)
+{
+    ImGuiContext* ctx = GImGui;
+    Ctx = (ctx != NULL && ctx->DebugHitchRecorder.Enabled) ? ctx : NULL;
+    Type = type;
+    TimeBegin = Ctx ? ImTimeGetNs() : 0;
+    if (Ctx != NULL)
+        Ctx->DebugHitchRecorder.EventsDepth++;
+}
+
+ImGuiDebugHitchEventScope::~ImGuiDebugHitchEventScope()
+{
+    if (Ctx == NULL)
+        return;
+    Ctx->DebugHitchRecorder.EventsDepth--;
+    DebugHitchesAddEvent(Ctx, Type, ImTimeGetNs() - TimeBegin);
+}
+
+// A frame is measured from NewFrame() to the end of Render() (or EndFrame() when Render() isn't called),
+// but events are collected until the next NewFrame(), where the previous frame is submitted.
+// Expensive events happening in-between (e.g. SaveIniSettingsToDisk() or font loading called by the application) are added to its time,
+// while idle time of the application (e.g. waiting for vsync or events) isn't.
+static void DebugHitchesNewFrame(ImGuiContext* ctx)
+{
+    ImGuiDebugHitchRecorder* recorder = &ctx->DebugHitchRecorder;
+    DebugHitchesSubmitFrame(ctx);
+    memset(recorder->FrameEvents, 0, sizeof(recorder->FrameEvents));
+    recorder->FrameTimeBegin = recorder->Enabled ? ImTimeGetNs() : 0;
+    recorder->FrameTimeEnd = recorder->FrameTimeAfterEnd = 0;
+}
+
+// Called at the end of EndFrame() and at the end of Render(): latest call wins.
+static void DebugHitchesEndFrame(ImGuiContext* ctx)
+{
+    ImGuiDebugHitchRecorder* recorder = &ctx->DebugHitchRecorder;
+    if (recorder->FrameTimeBegin != 0)
+        recorder->FrameTimeEnd = ImTimeGetNs();
+}
+
+static void DebugHitchesSubmitFrame(ImGuiContext* ctx)
+{
+    ImGuiDebugHitchRecorder* recorder = &ctx->DebugHitchRecorder;
+    if (!recorder->Enabled || recorder->FrameTimeBegin == 0 || recorder->FrameTimeEnd == 0)
+        return;
+    const ImU64 frame_time = recorder->FrameTimeEnd - recorder->FrameTimeBegin + recorder->FrameTimeAfterEnd;
+    if (frame_time < (ImU64)(recorder->ThresholdMs * 1000000.0f))
+        return;
+    if (recorder->Records.Size != recorder->RecordsCapacity)
+    {
+        // Allocate on first hitch, or reallocate after capacity change (previous records are lost)
+        IM_ASSERT(recorder->RecordsCapacity > 0);
+        recorder->Records.resize(recorder->RecordsCapacity);
+        recorder->RecordsWritten = 0;
+    }
+    ImGuiDebugHitchRecord* record = &recorder->Records[recorder->RecordsWritten++ % recorder->Records.Size];
+    record->FrameCount = ctx->FrameCount;
+    record->FrameTime = frame_time;
+    memcpy(record->Events, recorder->FrameEvents, sizeof(record->Events));
+}
+
+void ImGui::DebugHitchesClear()
+{
+    ImGuiContext& g = *GImGui;
+    g.DebugHitchRecorder.RecordsWritten = 0;
+}
+
+void ImGui::DebugHitchesExport(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugHitchRecorder* recorder = &g.DebugHitchRecorder;
+    const int records_count = ImMin(recorder->RecordsWritten, recorder->Records.Size);
+    buf->appendf("Dear ImGui %s: %d hitches (threshold %.1f ms)\n", IMGUI_VERSION, records_count, recorder->ThresholdMs);
+    for (int record_seq = recorder->RecordsWritten - records_count; record_seq < recorder->RecordsWritten; record_seq++)
+    {
+        const ImGuiDebugHitchRecord* record = &recorder->Records[record_seq % recorder->Records.Size];
+        buf->appendf("Frame %d: %.3f ms\n", record->FrameCount, record->FrameTime / 1000000.0);
+        for (int type = 0; type < ImGuiDebugHitchEventType_COUNT; type++)
+        {
+            const ImGuiDebugHitchEventStats* stats = &record->Events[type];
+            if (stats->Count > 0)
+                buf->appendf("  %-14s x%-5d total %8.3f ms, max %8.3f ms\n", GDebugHitchEventTypeNames[type], stats->Count, stats->TotalTime / 1000000.0, stats->MaxTime / 1000000.0);
+        }
+    }
+}
+
+bool ImGui::DebugHitchesSave(const char* filename)
+{
+    ImGuiTextBuffer buf;
+    DebugHitchesExport(&buf);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifndef IMGUI_DISABLE_DEBUG_TOOLS
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -15688,6 +17174,7 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 // - DebugNodeWindowSettings() [Internal]
 // - DebugNodeWindowsList() [Internal]
 // - DebugNodeWindowsListByBeginStackParent() [Internal]
+// - DebugNodeProfiler() [Internal]
 //-----------------------------------------------------------------------------
 
 #if !defined(IMGUI_DISABLE_DEMO_WINDOWS) || !defined(IMGUI_DISABLE_DEBUG_TOOLS)
@@ -16280,6 +17767,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         //SetNextItemOpen(true, ImGuiCond_Once);
         DebugNodeWindowsList(&g.Windows, "By display order");
         DebugNodeWindowsList(&g.WindowsFocusOrder, "By focus order (root windows)");
+        if (g.WindowsHibernated.GetAliveCount() > 0)
+            BulletText("Hibernated: %d (io.ConfigMemoryHibernateTimer)", g.WindowsHibernated.GetAliveCount());
         if (TreeNode("By submission order (begin stack)"))
         {
             // Here we display windows in their submitted order/hierarchy, however note that the Begin stack doesn't constitute a Parent<>Child relationship!
@@ -16458,7 +17947,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
+        Text("Frame arena: %d/%d bytes, %d allocations in last frame", info->FrameArenaAllocSize, g.FrameArena.Capacity, info->FrameArenaAllocCount);
+        Text("Frame arena: overflowed on %d frames", info->FrameArenaOverflowCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        if (g.IO.ConfigDebugIsDebuggerPresent)
+        {
+            SameLine();
+            Checkbox("Break in next alloc/free", &info->DebugBreakInAlloc);
+            SetItemTooltip("Call IM_DEBUG_BREAK() in next MemAlloc()/MemFree() call.\nUse when frames are expected to not allocate anymore (e.g. after a warm-up period) to find the source of an allocation.\nYou need a debugger attached or this will crash!");
+        }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -16474,6 +17971,23 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Profiler
+#ifdef IMGUI_ENABLE_PROFILER
+    DebugNodeProfiler(&g.Profiler);
+#else
+    if (TreeNode("Profiler"))
+    {
+        TextDisabled("Define IMGUI_ENABLE_PROFILER in imconfig.h to record timings of core functions.");
+        TreePop();
+    }
+#endif
+
+    // Costs
+    DebugNodeCosts();
+
+    // Hitches
+    DebugNodeHitches(&g.DebugHitchRecorder);
+
     if (TreeNode("Inputs"))
     {
         Text("KEYBOARD/GAMEPAD/MOUSE KEYS");
@@ -16609,6 +18123,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         Unindent();
 
+        Text("MISC");
+        Indent();
+        if (g.IO.NextWakeupDelay >= FLT_MAX)
+            Text("NextWakeupDelay: FLT_MAX (idle)");
+        else
+            Text("NextWakeupDelay: %.3f sec", g.IO.NextWakeupDelay);
+        Unindent();
+
         TreePop();
     }
 
@@ -16749,9 +18271,13 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     IM_UNUSED(viewport); // Used in docking branch
     ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
     int cmd_count = draw_list->CmdBuffer.Size;
-    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
+    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().RectCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open;
+    if (draw_list->RectBuffer.Size > 0)
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d rects, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->RectBuffer.Size, cmd_count);
+    else
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -16781,14 +18307,41 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         char texid_desc[30];
         FormatTextureIDForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), pcmd);
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-            pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d %s, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+            pcmd->RectCount ? pcmd->RectCount : pcmd->ElemCount / 3, pcmd->RectCount ? "rects" : "tris", texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
         if (!pcmd_node_open)
             continue;
 
+        // Display rect instances
+        if (pcmd->RectCount != 0)
+        {
+            const ImDrawRectInstance* rect_buffer = draw_list->RectBuffer.Data + pcmd->RectOffset;
+            float total_area = 0.0f;
+            for (unsigned int rect_n = 0; rect_n < pcmd->RectCount; rect_n++)
+                total_area += (rect_buffer[rect_n].PosMax.x - rect_buffer[rect_n].PosMin.x) * (rect_buffer[rect_n].PosMax.y - rect_buffer[rect_n].PosMin.y);
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "Rects: RectCount: %d, RectOffset: +%d, Area: ~%0.f px", pcmd->RectCount, pcmd->RectOffset, total_area);
+            Selectable(buf);
+            if (IsItemHovered() && fg_draw_list)
+                DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, true, false);
+            ImGuiListClipper clipper;
+            clipper.Begin(pcmd->RectCount);
+            while (clipper.Step())
+                for (int rect_n = clipper.DisplayStart; rect_n < clipper.DisplayEnd; rect_n++)
+                {
+                    const ImDrawRectInstance& r = rect_buffer[rect_n];
+                    ImFormatString(buf, IM_ARRAYSIZE(buf), "Rect: %04d: pos (%8.2f,%8.2f)-(%8.2f,%8.2f), uv (%.6f,%.6f)-(%.6f,%.6f), col %08X",
+                        pcmd->RectOffset + rect_n, r.PosMin.x, r.PosMin.y, r.PosMax.x, r.PosMax.y, r.UvMin.x, r.UvMin.y, r.UvMax.x, r.UvMax.y, r.Col);
+                    Selectable(buf, false);
+                    if (fg_draw_list && IsItemHovered())
+                        fg_draw_list->AddRect(r.PosMin, r.PosMax, IM_COL32(255, 255, 0, 255));
+                }
+            TreePop();
+            continue;
+        }
+
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
@@ -16819,9 +18372,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImVec2 uv = v.uv; // Decode compact vertices (IMGUI_USE_COMPACT_DRAWVERT) before passing to varargs
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -16859,6 +18413,14 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
+    for (unsigned int rect_n = draw_cmd->RectOffset, rect_end = draw_cmd->RectOffset + draw_cmd->RectCount; rect_n < rect_end; rect_n++)
+    {
+        const ImDrawRectInstance rect = draw_list->RectBuffer.Data[rect_n]; // Copy as ->AddRect() may invalidate buffer if out_draw_list==draw_list
+        vtxs_rect.Add(rect.PosMin);
+        vtxs_rect.Add(rect.PosMax);
+        if (show_mesh)
+            out_draw_list->AddRect(rect.PosMin, rect.PosMax, IM_COL32(255, 255, 0, 255)); // In yellow: rect instances
+    }
     // Draw bounding boxes
     if (show_aabb)
     {
@@ -17218,6 +18780,7 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    BulletText("SkipRefresh: %d, RefreshDirty: %d", window->SkipRefresh, window->RefreshDirty);
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
@@ -17286,6 +18849,284 @@ void ImGui::DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int wi
     }
 }
 
+struct ImGuiDebugCostsEntry
+{
+    const char*             Name;       // Window name, or outer window name for a table
+    ImGuiWindow*            Window;     // Either Window or Table is set
+    ImGuiTable*             Table;
+    const ImGuiDebugCosts*  Costs;
+    float                   SortKey;    // Value of sorted column (0.0f when sorting by name)
+};
+
+static int IMGUI_CDECL DebugCostsEntryComparerBySortKey(const void* lhs, const void* rhs)
+{
+    const ImGuiDebugCostsEntry* a = (const ImGuiDebugCostsEntry*)lhs;
+    const ImGuiDebugCostsEntry* b = (const ImGuiDebugCostsEntry*)rhs;
+    if (a->SortKey != b->SortKey)
+        return (a->SortKey < b->SortKey) ? -1 : +1;
+    if (int d = ImStricmp(a->Name, b->Name))
+        return d;
+    return (a->Table != NULL) - (b->Table != NULL);
+}
+
+// Per-window and per-table costs, sortable to find which windows/tables are consuming the frame budget.
+void ImGui::DebugNodeCosts()
+{
+    ImGuiContext& g = *GImGui;
+    if (!TreeNode("Costs"))
+        return;
+    Checkbox("Record", &g.DebugCostsEnabled);
+    SameLine();
+    MetricsHelpMarker(
+        "Record CPU time, items submitted (ItemAdd() calls), text bytes measured (CalcTextSize() calls) and allocations (MemAlloc() calls) for each window and table.\n"
+        "Values are moving averages per frame.\n"
+        "- Window time excludes child windows, popups and tooltips, which are listed separately.\n"
+        "- Table time includes nested tables and child windows.");
+
+    // Gather windows and tables submitted during current or last frame
+    ImVector<ImGuiDebugCostsEntry> entries;
+    float windows_time = 0.0f;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        windows_time += window->DebugCosts.TimeAvg;
+        if (window->LastFrameActive < g.FrameCount - 1)
+            continue;
+        ImGuiDebugCostsEntry entry = { window->Name, window, NULL, &window->DebugCosts, 0.0f };
+        entries.push_back(entry);
+    }
+    const int windows_count = entries.Size;
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            if (table->LastFrameActive < g.FrameCount - 1)
+                continue;
+            ImGuiDebugCostsEntry entry = { table->OuterWindow ? table->OuterWindow->Name : "N/A", NULL, table, &table->DebugCosts, 0.0f };
+            entries.push_back(entry);
+        }
+    Text("%d windows, %d tables. Windows total: %.1f us/frame", windows_count, entries.Size - windows_count, windows_time);
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit;
+    if (BeginTable("##costs", 6, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Type", ImGuiTableColumnFlags_NoSort);
+        TableSetupColumn("Time (us)", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+        TableSetupColumn("Items", ImGuiTableColumnFlags_PreferSortDescending);
+        TableSetupColumn("Text bytes", ImGuiTableColumnFlags_PreferSortDescending);
+        TableSetupColumn("Allocs", ImGuiTableColumnFlags_PreferSortDescending);
+        TableHeadersRow();
+
+        // Sort every frame as values keep changing
+        const ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs();
+        if (sort_specs != NULL && sort_specs->SpecsCount > 0)
+        {
+            const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[0];
+            for (ImGuiDebugCostsEntry& entry : entries)
+            {
+                const ImGuiDebugCosts* costs = entry.Costs;
+                entry.SortKey = (spec->ColumnIndex == 2) ? costs->TimeAvg : (spec->ColumnIndex == 3) ? costs->ItemsCountAvg : (spec->ColumnIndex == 4) ? costs->TextBytesAvg : (spec->ColumnIndex == 5) ? costs->AllocCountAvg : 0.0f;
+            }
+            if (entries.Size > 1)
+                ImQsort(entries.Data, (size_t)entries.Size, sizeof(entries[0]), DebugCostsEntryComparerBySortKey);
+            if (spec->SortDirection == ImGuiSortDirection_Descending)
+                for (int n = 0; n < entries.Size / 2; n++)
+                    ImSwap(entries[n], entries[entries.Size - 1 - n]);
+        }
+
+        ImGuiListClipper clipper;
+        clipper.Begin(entries.Size);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const ImGuiDebugCostsEntry* entry = &entries[n];
+                const ImGuiDebugCosts* costs = entry->Costs;
+                TableNextRow();
+                TableNextColumn();
+                PushID(entry->Table ? (void*)entry->Table : (void*)entry->Window);
+                Selectable("##row", false, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowOverlap);
+                if (IsItemHovered())
+                {
+                    // Highlight window or table
+                    ImGuiWindow* window = entry->Window ? entry->Window : entry->Table->OuterWindow;
+                    ImRect rect = entry->Window ? entry->Window->Rect() : entry->Table->OuterRect;
+                    if (window != NULL)
+                        GetForegroundDrawList(window)->AddRect(rect.Min, rect.Max, IM_COL32(255, 255, 0, 255));
+                }
+                PopID();
+                SameLine(0.0f, 0.0f);
+                TextUnformatted(entry->Name);
+                TableNextColumn();
+                if (entry->Table)
+                    Text("Table 0x%08X", entry->Table->ID);
+                else
+                    TextUnformatted((entry->Window->Flags & ImGuiWindowFlags_Tooltip) ? "Tooltip" : (entry->Window->Flags & ImGuiWindowFlags_Popup) ? "Popup" : (entry->Window->Flags & ImGuiWindowFlags_ChildWindow) ? "Child" : "Window");
+                TableNextColumn(); Text("%.1f", costs->TimeAvg);
+                TableNextColumn(); Text("%.0f", costs->ItemsCountAvg);
+                TableNextColumn(); Text("%.0f", costs->TextBytesAvg);
+                TableNextColumn(); Text("%.1f", costs->AllocCountAvg);
+            }
+        EndTable();
+    }
+    TreePop();
+}
+
+// Display recorded hitches, newest first
+void ImGui::DebugNodeHitches(ImGuiDebugHitchRecorder* recorder)
+{
+    ImGuiContext& g = *GImGui;
+    const int records_count = ImMin(recorder->RecordsWritten, recorder->Records.Size);
+    if (!TreeNode("Hitches", "Hitches (%d)", records_count))
+        return;
+    Checkbox("Record", &recorder->Enabled);
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 8);
+    DragFloat("Threshold", &recorder->ThresholdMs, 0.5f, 1.0f, 1000.0f, "%.1f ms");
+    SameLine();
+    MetricsHelpMarker("Frames whose CPU time between NewFrame() and the end of Render() exceeds the threshold are recorded, along with the expensive internal events which happened from their NewFrame() to the next one.\nExpensive events happening after Render() (e.g. .ini saving or font loading from the application) are added to the frame time.\nEvent times are inclusive: e.g. a texture grow triggered by a glyph load is counted in both.");
+    if (SmallButton("Clear"))
+        DebugHitchesClear();
+#ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+    SameLine();
+    if (SmallButton("Save imgui_hitches.txt"))
+        DebugHitchesSave("imgui_hitches.txt");
+#endif
+    SameLine();
+    if (SmallButton("Copy"))
+    {
+        ImGuiTextBuffer buf;
+        DebugHitchesExport(&buf);
+        SetClipboardText(buf.c_str());
+    }
+
+    for (int record_seq = recorder->RecordsWritten - 1; record_seq >= recorder->RecordsWritten - records_count; record_seq--)
+    {
+        const ImGuiDebugHitchRecord* record = &recorder->Records[record_seq % recorder->Records.Size];
+        if (!TreeNode((void*)(intptr_t)record_seq, "Frame %d: %.1f ms (%d frames ago)", record->FrameCount, record->FrameTime / 1000000.0, g.FrameCount - record->FrameCount))
+            continue;
+        int events_count = 0;
+        for (int type = 0; type < ImGuiDebugHitchEventType_COUNT; type++)
+        {
+            const ImGuiDebugHitchEventStats* stats = &record->Events[type];
+            if (stats->Count == 0)
+                continue;
+            BulletText("%s: x%d, total %.3f ms, max %.3f ms", GDebugHitchEventTypeNames[type], stats->Count, stats->TotalTime / 1000000.0, stats->MaxTime / 1000000.0);
+            events_count++;
+        }
+        if (events_count == 0)
+            TextDisabled("No recorded events: time was spent in application code or in core functions.");
+        TreePop();
+    }
+    TreePop();
+}
+
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerZoneStats
+{
+    const char* Name;
+    int         Count;
+    ImU64       TotalTime;
+    ImU64       MaxTime;
+};
+
+static int IMGUI_CDECL ProfilerZoneStatsComparerByTotalTime(const void* lhs, const void* rhs)
+{
+    const ImGuiProfilerZoneStats* a = (const ImGuiProfilerZoneStats*)lhs;
+    const ImGuiProfilerZoneStats* b = (const ImGuiProfilerZoneStats*)rhs;
+    return (a->TotalTime < b->TotalTime) ? +1 : (a->TotalTime > b->TotalTime) ? -1 : 0;
+}
+
+// Display zones of last completed frame
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    if (!TreeNode("Profiler", "Profiler (%d zones)", (int)ImMin(profiler->ZonesWritten, (ImU64)profiler->Zones.Size)))
+        return;
+    Checkbox("Record", &profiler->Enabled);
+    SameLine();
+    if (SmallButton("Clear"))
+        ProfilerClear();
+#ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+    SameLine();
+    if (SmallButton("Save imgui_trace.json"))
+        ProfilerSaveChromeTrace("imgui_trace.json");
+    SetItemTooltip("Save in Chrome trace format, to open in chrome://tracing or https://ui.perfetto.dev");
+#endif
+    SameLine();
+    if (SmallButton("Copy"))
+    {
+        ImGuiTextBuffer buf;
+        ProfilerExportChromeTrace(&buf);
+        SetClipboardText(buf.c_str());
+    }
+    SetItemTooltip("Copy to clipboard in Chrome trace format.");
+
+    // Gather zones of last frame
+    const int frame_count = g.FrameCount - 1;
+    ImVector<int> zones_idx;
+    ImVector<ImGuiProfilerZoneStats> stats;
+    const ImU64 zones_count = ImMin(profiler->ZonesWritten, (ImU64)profiler->Zones.Size);
+    for (ImU64 zone_seq = profiler->ZonesWritten - zones_count; zone_seq < profiler->ZonesWritten; zone_seq++)
+    {
+        const int zone_n = (int)(zone_seq % (ImU64)profiler->Zones.Size);
+        const ImGuiProfilerZone* zone = &profiler->Zones[zone_n];
+        if (zone->FrameCount != frame_count || zone->TimeEnd == 0)
+            continue;
+        zones_idx.push_back(zone_n);
+        ImGuiProfilerZoneStats* zone_stats = NULL;
+        for (ImGuiProfilerZoneStats& it : stats)
+            if (it.Name == zone->Name)
+                zone_stats = &it;
+        if (zone_stats == NULL)
+        {
+            ImGuiProfilerZoneStats new_stats = { zone->Name, 0, 0, 0 };
+            stats.push_back(new_stats);
+            zone_stats = &stats.back();
+        }
+        const ImU64 zone_time = zone->TimeEnd - zone->TimeBegin;
+        zone_stats->Count++;
+        zone_stats->TotalTime += zone_time;
+        zone_stats->MaxTime = ImMax(zone_stats->MaxTime, zone_time);
+    }
+    if (stats.Size > 1)
+        ImQsort(stats.Data, (size_t)stats.Size, sizeof(stats[0]), ProfilerZoneStatsComparerByTotalTime);
+
+    Text("Frame %d: %d zones", frame_count, zones_idx.Size);
+    if (BeginTable("##stats", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn("Zone");
+        TableSetupColumn("Count");
+        TableSetupColumn("Total (ms)");
+        TableSetupColumn("Max (ms)");
+        TableHeadersRow();
+        for (const ImGuiProfilerZoneStats& zone_stats : stats)
+        {
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(zone_stats.Name);
+            TableNextColumn(); Text("%d", zone_stats.Count);
+            TableNextColumn(); Text("%.3f", zone_stats.TotalTime / 1000000.0);
+            TableNextColumn(); Text("%.3f", zone_stats.MaxTime / 1000000.0);
+        }
+        EndTable();
+    }
+
+    if (TreeNode("Zones", "Zones (%d)", zones_idx.Size))
+    {
+        ImGuiListClipper clipper;
+        clipper.Begin(zones_idx.Size);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const ImGuiProfilerZone* zone = &profiler->Zones[zones_idx[n]];
+                const char* id_name = ProfilerGetZoneIDName(zone->ID);
+                Text("%*s%s%s%s%s: %.3f ms", zone->Depth * 2, "", zone->Name, id_name ? " '" : "", id_name ? id_name : "", id_name ? "'" : "", (zone->TimeEnd - zone->TimeBegin) / 1000000.0);
+            }
+        TreePop();
+    }
+    TreePop();
+}
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] DEBUG LOG WINDOW
 //-----------------------------------------------------------------------------
@@ -17767,6 +19608,14 @@ void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
+void ImGui::DebugNodeCosts() {}
+void ImGui::DebugNodeHitches(ImGuiDebugHitchRecorder*) {}
+void ImGui::DebugHitchesClear() {}
+void ImGui::DebugHitchesExport(ImGuiTextBuffer*) {}
+bool ImGui::DebugHitchesSave(const char*) { return false; }
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 
 void ImGui::ShowDebugLogWindow(bool*) {}
 void ImGui::ShowIDStackToolWindow(bool*) {}
@@ -48,7 +48,7 @@ Index of this file:
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -165,10 +165,12 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataSnapshot;          // Draw data owning its draw lists, to hand over to a render thread (see TakeDrawDataSnapshot())
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawRectInstance;          // A single axis-aligned rectangle (pos + uv + col = 36 bytes), output instead of vertices when ImGuiBackendFlags_RendererHasRectInstances is set
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
@@ -394,6 +396,7 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can then get call GetDrawData().
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). Call ImGui_ImplXXXX_RenderDrawData() function in your Renderer Backend to render.
+    IMGUI_API void          TakeDrawDataSnapshot(ImDrawDataSnapshot* snapshot); // [EXPERIMENTAL] valid after Render(). Move draw data into 'snapshot', which stays valid after the next NewFrame() so it can be rendered from another thread. See ImDrawDataSnapshot.
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window. demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -966,6 +969,14 @@ namespace ImGui
     IMGUI_API void                  EndDragDropTarget();                                                            // only call EndDragDropTarget() if BeginDragDropTarget() returns true!
     IMGUI_API const ImGuiPayload*   GetDragDropPayload();                                                           // peek directly into the current payload from anywhere. returns NULL when drag and drop is finished or inactive. use ImGuiPayload::IsDataType() to test for the payload type.
 
+    // Sub-contexts [EXPERIMENTAL]
+    // - Build a heavy panel (e.g. large log or table) in its own context, possibly updated on a worker thread (see IMGUI_USE_THREAD_LOCAL_CONTEXT, ImFontAtlas::LockFunc to share the atlas).
+    // - SubContextView() reserves a region in the current window, composites the last draw data rendered by 'child_ctx' into it,
+    //   and routes inputs to 'child_ctx' for its next frame. The child's io.DisplaySize is set to the region size.
+    // - It reads and writes 'child_ctx': call it while the child context is not within NewFrame()..Render() (e.g. after joining its worker).
+    // - Clicking the region gives keyboard focus to the child context, until clicking elsewhere. Return true while focused.
+    IMGUI_API bool          SubContextView(const char* str_id, ImGuiContext* child_ctx, const ImVec2& size = ImVec2(0, 0)); // size==0.0f: use remaining content region, size<0.0f: right/bottom-align
+
     // Disabling [BETA API]
     // - Disable all user interactions and dim items visuals (applying style.DisabledAlpha over current colors)
     // - Those can be nested but it cannot be used to enable an already disabled section (a single BeginDisabled(true) in the stack is enough to keep everything disabled)
@@ -1029,6 +1040,7 @@ namespace ImGui
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
+    IMGUI_API void          RequestWakeup(float delay = 0.0f);                                  // request a new frame within 'delay' seconds even if no inputs are received (e.g. for custom animations). lowest requested value of the frame is output in io.NextWakeupDelay.
 
     // Text Utilities
     IMGUI_API ImVec2        CalcTextSize(const char* text, const char* text_end = NULL, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
@@ -1694,6 +1706,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasRectInstances = 1 << 5, // Backend Renderer supports ImDrawCmd::RectCount > 0: axis-aligned rectangles (filled rectangles, images, text glyphs) are output as compact ImDrawRectInstance instead of 4 vertices + 6 indices each. Backends only set it when io.ConfigDrawListRectInstances is enabled.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2382,6 +2395,10 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    float       ConfigMemoryHibernateTimer;     // = -1.0f          // [EXPERIMENTAL] Timer (in seconds) to destroy windows when unused, keeping a compact record of their state which is restored on their next Begin(). Set to -1.0f to disable. Invalidates ImGuiWindow* pointers held by users of imgui_internal.h!
+    bool        ConfigDrawDataMergeDrawLists;   // = false          // [EXPERIMENTAL] At the end of Render(), concatenate draw lists of each ImDrawData into fewer larger ones and merge their draw commands when texture matches and clip rectangles allow it. Reduce draw calls and buffer uploads at the cost of copying vertices. ImDrawData::CmdLists[] won't point to window draw lists anymore.
+    bool        ConfigDrawDataFingerprint;      // = false          // In Render(), calculate ImDrawData::Fingerprint and set io.WantRender = false when draw data and textures are unchanged since previous frame. Draw lists reused from previous frame (see ImGuiWindowRefreshFlags_TryToAvoidRefresh) are not hashed again.
+    bool        ConfigDrawListRectInstances;    // = false          // [EXPERIMENTAL] Allow renderer backends supporting it to set ImGuiBackendFlags_RendererHasRectInstances, outputting axis-aligned rectangles (text glyphs, filled rectangles, images) as compact ImDrawRectInstance. Those have no vertices: leave disabled if you post-process vertices of text/rectangles (e.g. ShadeVertsTransformPos(), ShadeVertsLinearColorGradientKeepAlpha()) or they will be silently ignored.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2491,6 +2508,8 @@ struct ImGuiIO
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when io.ConfigNavMoveSetMousePos is enabled.
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    bool        WantRender;                         // Set by Render(). Always true unless io.ConfigDrawDataFingerprint is set, in which case this is false when draw data and textures are identical to the previous frame: you may skip rendering and presenting/swapping buffers (but still render after your framebuffer was lost or resized, and if your own rendering changed).
+    float       NextWakeupDelay;                    // Set by EndFrame(). Delay (in seconds) after which a new frame is required even if no inputs are received: timers, blinking text cursor, tooltip delays, key repeat, .ini saving etc. 0.0f if a new frame is required as soon as possible, FLT_MAX if the UI is idle. An event-driven application may wait for inputs with this timeout instead of polling (see examples).
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation highlight is visible and allowed (will handle ImGuiKey_NavXXX events).
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
@@ -3055,7 +3074,7 @@ struct ImGuiSelectionExternalStorage
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -3077,6 +3096,7 @@ typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibilit
 //  A) Change your GPU render state,
 //  B) render a complex 3D scene inside a UI element without an intermediate texture/render target, etc.
 // The expected behavior from your rendering function is 'if (cmd.UserCallback != NULL) { cmd.UserCallback(parent_list, cmd); } else { RenderTriangles() }'
+// (with ImGuiBackendFlags_RendererHasRectInstances: 'else if (cmd.RectCount > 0) { RenderRectInstances() }' before RenderTriangles())
 // If you want to override the signature of ImDrawCallback, you can simply use e.g. '#define ImDrawCallback MyDrawCallback' (in imconfig.h) + update rendering backend accordingly.
 #ifndef ImDrawCallback
 typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* cmd);
@@ -3092,6 +3112,9 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - RectOffset/RectCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances' is enabled,
+//   a command may instead render RectCount instances of ImDrawRectInstance stored in the ImDrawList's RectBuffer[] array.
+//   A command never holds both triangles and rect instances: when RectCount > 0, ElemCount == 0.
 // - The ClipRect/TexRef/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -3100,6 +3123,8 @@ struct ImDrawCmd
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
+    unsigned int    RectOffset;         // 4    // Start offset in rect instance buffer (ImDrawList::RectBuffer[]).
+    unsigned int    RectCount;          // 4    // Number of rect instances to be rendered. Always 0 unless ImGuiBackendFlags_RendererHasRectInstances is set.
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // Callback user data (when UserCallback != NULL). If called AddCallback() with size == 0, this is a copy of the AddCallback() argument. If called AddCallback() with size > 0, this is pointing to a buffer where data is stored.
     int             UserCallbackDataSize;  // 4 // Size of callback user data when using storage, otherwise 0.
@@ -3113,7 +3138,52 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes instead of 20), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+// - pos: 2x signed 16-bit fixed point, 1/IM_DRAWVERT_COMPACT_POS_SCALE pixel precision. Default to 1/8 pixel, allowing positions in the -4096..+4095 range (values out of range are clamped).
+// - uv:  2x unsigned 16-bit normalized (values outside of 0..1 are clamped, so UV wrapping/repeat is not supported).
+// - col: ImU32, unchanged.
+// Components are encoded on write and decoded on read, so code writing 'vtx.pos = ImVec2(...)' or 'vtx.uv.x = ...' keeps working.
+// Your renderer backend needs to declare the pos attribute as 2x GL_SHORT (non-normalized, then scaled by 1/IM_DRAWVERT_COMPACT_POS_SCALE) and the uv attribute as 2x GL_UNSIGNED_SHORT normalized.
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT are mutually exclusive."
+#endif
+#ifndef IM_DRAWVERT_COMPACT_POS_SCALE
+#define IM_DRAWVERT_COMPACT_POS_SCALE   8.0f
+#endif
+struct ImDrawVertPosComponent
+{
+    ImS16   Value;
+    operator float() const                              { return (float)Value * (1.0f / IM_DRAWVERT_COMPACT_POS_SCALE); }
+    ImDrawVertPosComponent& operator=(float f)          { f = f * IM_DRAWVERT_COMPACT_POS_SCALE; f = f < -32768.0f ? -32768.0f : f; f = f > 32767.0f ? 32767.0f : f; Value = (ImS16)((int)(f + 32768.5f) - 32768); return *this; } // Clamp and round to nearest
+    ImDrawVertPosComponent& operator+=(float f)         { return *this = (float)*this + f; }
+    ImDrawVertPosComponent& operator-=(float f)         { return *this = (float)*this - f; }
+};
+struct ImDrawVertUVComponent
+{
+    ImU16   Value;
+    operator float() const                              { return (float)Value * (1.0f / 65535.0f); }
+    ImDrawVertUVComponent& operator=(float f)           { f = f * 65535.0f; f = f < 0.0f ? 0.0f : f; f = f > 65535.0f ? 65535.0f : f; Value = (ImU16)(int)(f + 0.5f); return *this; } // Clamp and round to nearest
+};
+struct ImDrawVertPos
+{
+    ImDrawVertPosComponent x, y;
+    operator ImVec2() const                             { return ImVec2(x, y); }
+    ImDrawVertPos& operator=(const ImVec2& v)           { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVertUV
+{
+    ImDrawVertUVComponent x, y;
+    operator ImVec2() const                             { return ImVec2(x, y); }
+    ImDrawVertUV& operator=(const ImVec2& v)            { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -3128,6 +3198,18 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Rectangle instance, used by ImDrawCmd with RectCount > 0 (only when ImGuiBackendFlags_RendererHasRectInstances is set)
+// Equivalent to a quad made of 4 ImDrawVert: (PosMin, UvMin), (PosMax.x/PosMin.y, UvMax.x/UvMin.y), (PosMax, UvMax), (PosMin.x/PosMax.y, UvMin.x/UvMax.y), all using Col.
+// At 36 bytes, it replaces 4*sizeof(ImDrawVert) + 6*sizeof(ImDrawIdx) = 92 bytes (with default types).
+struct ImDrawRectInstance
+{
+    ImVec2  PosMin;
+    ImVec2  PosMax;
+    ImVec2  UvMin;
+    ImVec2  UvMax;
+    ImU32   Col;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -3141,6 +3223,7 @@ struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
     ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawRectInstance> _RectBuffer;
 };
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
@@ -3171,6 +3254,9 @@ enum ImDrawFlags_
     ImDrawFlags_RoundCornersBottomLeft      = 1 << 6, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-left corner only (when rounding > 0.0f, we default to all corners). Was 0x04.
     ImDrawFlags_RoundCornersBottomRight     = 1 << 7, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-right corner only (when rounding > 0.0f, we default to all corners). Wax 0x08.
     ImDrawFlags_RoundCornersNone            = 1 << 8, // AddRect(), AddRectFilled(), PathRect(): disable rounding on all corners (when rounding > 0.0f). This is NOT zero, NOT an implicit flag!
+    ImDrawFlags_JoinMiter                   = 1 << 9, // PathStroke(), AddPolyline(): non anti-aliased lines share vertices between segments, with miter joins (bevel on sharp angles). Anti-aliased lines always use shared miter joins.
+    ImDrawFlags_JoinBevel                   = 1 << 10,// PathStroke(), AddPolyline(): non anti-aliased lines share vertices between segments, with bevel joins. Anti-aliased lines always use shared miter joins.
+    ImDrawFlags_Decimate                    = 1 << 11,// PathStroke(), AddPolyline(): decimate dense lines (e.g. plots with many more points than pixels), merging consecutive points within the same style.CurveTessellationTol wide column into their first/min/max/last points.
     ImDrawFlags_RoundCornersTop             = ImDrawFlags_RoundCornersTopLeft | ImDrawFlags_RoundCornersTopRight,
     ImDrawFlags_RoundCornersBottom          = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersBottomRight,
     ImDrawFlags_RoundCornersLeft            = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersTopLeft,
@@ -3178,6 +3264,7 @@ enum ImDrawFlags_
     ImDrawFlags_RoundCornersAll             = ImDrawFlags_RoundCornersTopLeft | ImDrawFlags_RoundCornersTopRight | ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersBottomRight,
     ImDrawFlags_RoundCornersDefault_        = ImDrawFlags_RoundCornersAll, // Default to ALL corners if none of the _RoundCornersXX flags are specified.
     ImDrawFlags_RoundCornersMask_           = ImDrawFlags_RoundCornersAll | ImDrawFlags_RoundCornersNone,
+    ImDrawFlags_JoinMask_                   = ImDrawFlags_JoinMiter | ImDrawFlags_JoinBevel,
 };
 
 // Flags for ImDrawList instance. Those are set automatically by ImGui:: functions from ImGuiIO settings, and generally not manipulated directly.
@@ -3189,6 +3276,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowRectInstances      = 1 << 4,  // Can emit 'RectCount > 0' commands for axis-aligned rectangles. Set when 'ImGuiBackendFlags_RendererHasRectInstances' is enabled. Clear it temporarily if you need to post-process vertices of text or rectangles (e.g. ShadeVertsTransformPos()).
 };
 
 // Draw command list
@@ -3206,6 +3294,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawRectInstance> RectBuffer;    // Rect instance buffer. Each command consume ImDrawCmd::RectCount of those (only when ImDrawListFlags_AllowRectInstances is set).
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3221,6 +3310,8 @@ struct ImDrawList
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+    ImU64                   _Fingerprint;       // [Internal] Hash of contents calculated by Render() when io.ConfigDrawDataFingerprint is set, reused until the draw list is reset. 0 when unknown.
+    bool                    _RetainedForNextFrame; // [Internal] Contents may be displayed again next frame without being rebuilt (see ImGuiWindowRefreshFlags_TryToAvoidRefresh). Set by Begin(), read by TakeDrawDataSnapshot().
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
     // (advanced: you may create and use your own ImDrawListSharedData so you can use ImDrawList without ImGui, but that's more involved)
@@ -3268,6 +3359,15 @@ struct ImDrawList
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, int num_points, ImU32 col);
 
+    // Batched primitives
+    // - Submit many primitives in one call: geometry is reserved once per chunk and written in a tight loop, which is much faster
+    //   than calling AddRectFilled()/AddCircleFilled()/AddLine() in a loop when drawing e.g. scatter plots, heatmaps or timelines.
+    // - 'cols' holds one color per item, read with a stride of 'cols_stride' bytes. Pass 'cols_stride = 0' to use the same color for all items.
+    // - Output is the same as the equivalent single primitive function, except circles are drawn as evenly spaced regular polygons.
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count, int cols_stride = sizeof(ImU32));
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments = 0, int cols_stride = sizeof(ImU32));
+    IMGUI_API void  AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness = 1.0f, int cols_stride = sizeof(ImU32));
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID/ImTextureRef are.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -3306,6 +3406,7 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  AddDrawList(const ImDrawList* src_list, const ImVec2& offset); // Append output of another draw list (e.g. from another context's ImDrawData after Render()), translated by 'offset' and clipped by current clip rectangle.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3328,6 +3429,9 @@ struct ImDrawList
     inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
+    IMGUI_API ImDrawRectInstance* PrimReserveRects(int rect_count);             // Reserve rect instances (requires ImDrawListFlags_AllowRectInstances). Returns pointer to write them to.
+    IMGUI_API void  PrimUnreserveRects(int rect_count);
+    IMGUI_API void  PrimRectInstance(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col); // Axis aligned rectangle as a single rect instance (requires ImDrawListFlags_AllowRectInstances)
 
     // Obsolete names
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -3364,12 +3468,14 @@ struct ImDrawData
     int                 CmdListsCount;      // == CmdLists.Size. (OBSOLETE: exists for legacy reasons). Number of ImDrawList* to render.
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 TotalRectCount;     // For convenience, sum of all ImDrawList's RectBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overriden or set to NULL if you want to manually update textures.
+    ImU64               Fingerprint;        // Hash of draw commands, vertices, indices, texture references and display rectangle, set by Render() when io.ConfigDrawDataFingerprint is enabled. 0 when disabled or when using user callbacks (contents unknown).
 
     // Functions
     ImDrawData()    { Clear(); }
@@ -3379,6 +3485,25 @@ struct ImDrawData
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// [EXPERIMENTAL] Draw data owning its draw lists, filled by ImGui::TakeDrawDataSnapshot() after Render(), so rendering can overlap with building the next frame.
+// - Buffers are swapped with the context's draw lists rather than copied: the snapshot gets this frame's buffers and gives back those of the frame it previously held.
+//   So after a warm-up, taking a snapshot doesn't copy vertices nor allocate. Draw lists which may be reused by the next frame (e.g. ImGuiWindowRefreshFlags_Retained windows) are copied.
+// - Use two snapshots (double-buffering): the UI thread takes one while the render thread renders the other, then they are exchanged (protected by your own mutex/condition variable).
+//   The render thread calls e.g. ImGui_ImplXXXX_RenderDrawData(&snapshot->DrawData).
+// - Textures are shared with the UI thread, which may update them during the next frame: if 'Textures' is not empty, the renderer needs to have processed
+//   them (e.g. with ImGui_ImplXXXX_UpdateTexture(), or at the start of ImGui_ImplXXXX_RenderDrawData()) before the UI thread calls NewFrame() again.
+//   This only happens on frames where a texture is created, updated or destroyed. Other frames don't need any synchronization besides exchanging the snapshots.
+struct ImDrawDataSnapshot
+{
+    ImDrawData                  DrawData;       // Draw data to render. DrawData.CmdLists[] are owned by the snapshot. DrawData.Textures points to 'Textures' below.
+    ImVector<ImTextureData*>    Textures;       // Textures with pending requests (Status != ImTextureStatus_OK) when the snapshot was taken.
+    ImVector<ImDrawList*>       DrawListsPool;  // [Internal] Draw lists owned by the snapshot, recycled.
+
+    ImDrawDataSnapshot()        { }
+    ~ImDrawDataSnapshot()       { Clear(); }
+    IMGUI_API void  Clear();                    // Destroy owned draw lists and free memory.
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 //-----------------------------------------------------------------------------
@@ -3561,6 +3686,15 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
+// Operations requested from ImFontAtlas::LockFunc, when an atlas is shared by contexts updated from multiple threads.
+enum ImFontAtlasLockOp
+{
+    ImFontAtlasLockOp_LockShared,       // e.g. std::shared_mutex::lock_shared()
+    ImFontAtlasLockOp_UnlockShared,     // e.g. std::shared_mutex::unlock_shared()
+    ImFontAtlasLockOp_LockExclusive,    // e.g. std::shared_mutex::lock()
+    ImFontAtlasLockOp_UnlockExclusive,  // e.g. std::shared_mutex::unlock()
+};
+
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
@@ -3678,6 +3812,15 @@ struct ImFontAtlas
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
+    // [Multi-threading] Optional lock hook, to share an atlas between contexts updated concurrently from different threads (each thread using its own context, see IMGUI_USE_THREAD_LOCAL_CONTEXT).
+    // - Map the operations to a readers-writer lock. A context holds a shared lock during NewFrame()..EndFrame() and during Render().
+    //   Loading a new glyph or a new font size temporarily trades it for an exclusive lock, so this is cheap once glyphs in use are loaded.
+    // - The atlas needs to be created by you (not owned by a context) and you need to call ImFontAtlasUpdateNewFrame() at a point where no context is within a frame.
+    // - Rendering draw data needs a shared lock. Processing texture updates from platform_io.Textures[] needs an exclusive lock.
+    // - Contexts don't toggle the 'Locked' field of such atlas (done for backends without ImGuiBackendFlags_RendererHasTextures): set it yourself if needed.
+    // - See examples/example_null/stress_threads.cpp.
+    void                        (*LockFunc)(ImFontAtlas* atlas, ImFontAtlasLockOp op);
+
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
     // - This should not affect you as you can always use the latest value. But note that any precomputed UV coordinates are only valid for the current TexRef.
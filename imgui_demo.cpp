@@ -471,6 +471,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             // The "NoMouse" option can get us stuck with a disabled mouse! Let's provide an alternative way to fix it:
             if (io.ConfigFlags & ImGuiConfigFlags_NoMouse)
             {
+                ImGui::RequestWakeup(0.20f - fmodf((float)ImGui::GetTime(), 0.20f)); // Request a frame for the next blink (for applications waiting for events)
                 if (fmodf((float)ImGui::GetTime(), 0.40f) < 0.20f)
                 {
                     ImGui::SameLine();
@@ -525,6 +526,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
+            ImGui::SeparatorText("Rendering");
+            ImGui::Checkbox("io.ConfigDrawDataMergeDrawLists", &io.ConfigDrawDataMergeDrawLists); // [EXPERIMENTAL]
+            ImGui::SameLine(); HelpMarker("*EXPERIMENTAL* Concatenate draw lists into fewer larger ones at the end of Render(), merging draw commands when texture matches and clip rectangles allow it.\n\nReduce draw calls and buffer uploads at the cost of copying vertices.");
+            ImGui::Checkbox("io.ConfigDrawDataFingerprint", &io.ConfigDrawDataFingerprint);
+            ImGui::SameLine(); HelpMarker("Calculate a fingerprint of draw data in Render(). io.WantRender is set to false when draw data and textures are unchanged since previous frame, so the application may skip rendering and presenting.");
+            ImGui::Checkbox("io.ConfigDrawListRectInstances", &io.ConfigDrawListRectInstances); // [EXPERIMENTAL]
+            ImGui::SameLine(); HelpMarker("*EXPERIMENTAL* Allow renderer backends supporting it to set ImGuiBackendFlags_RendererHasRectInstances, outputting text glyphs, filled rectangles and images as compact rect instances instead of vertices.\n\nDisable if you post-process vertices of text/rectangles (e.g. ShadeVertsTransformPos()).");
+
             // Also read: https://github.com/ocornut/imgui/wiki/Error-Handling
             ImGui::SeparatorText("Error Handling");
 
@@ -577,6 +586,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasTextures",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasRectInstances", &io.BackendFlags, ImGuiBackendFlags_RendererHasRectInstances);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -1999,6 +2009,8 @@ static void DemoWindowWidgetsPlotting()
             phase += 0.10f * values_offset;
             refresh_time += 1.0f / 60.0f;
         }
+        if (animate)
+            ImGui::RequestWakeup((float)(refresh_time - ImGui::GetTime())); // Request a frame for next data point (for applications waiting for events)
 
         // Plots can display overlay texts
         // (in this example, we will display an average value)
@@ -2048,6 +2060,7 @@ static void DemoWindowWidgetsProgressBars()
         progress += progress_dir * 0.4f * ImGui::GetIO().DeltaTime;
         if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
         if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
+        ImGui::RequestWakeup(); // Animated: request a new frame as soon as possible (for applications waiting for events)
 
         // Typically we would use ImVec2(-1.0f,0.0f) or ImVec2(-FLT_MIN,0.0f) to use all available width,
         // or ImVec2(width,0.0f) for a specified width. ImVec2(0.0f,0.0f) uses ItemWidth.
@@ -2357,7 +2370,10 @@ static void DemoWindowWidgetsSelectables()
             const float time = (float)ImGui::GetTime();
             const bool winning_state = memchr(selected, 0, sizeof(selected)) == NULL; // If all cells are selected...
             if (winning_state)
+            {
                 ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f + 0.5f * cosf(time * 2.0f), 0.5f + 0.5f * sinf(time * 3.0f)));
+                ImGui::RequestWakeup(); // Animated
+            }
 
             for (int y = 0; y < 4; y++)
                 for (int x = 0; x < 4; x++)
@@ -3922,6 +3938,7 @@ static void DemoWindowWidgetsTooltips()
             static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
             ImGui::PlotLines("Curve", arr, IM_ARRAYSIZE(arr));
             ImGui::Text("Sin(time) = %f", sinf((float)ImGui::GetTime()));
+            ImGui::RequestWakeup();
             ImGui::EndTooltip();
         }
 
@@ -3940,6 +3957,7 @@ static void DemoWindowWidgetsTooltips()
         else if (always_on == 2 && ImGui::BeginTooltip())
         {
             ImGui::ProgressBar(sinf((float)ImGui::GetTime()) * 0.5f + 0.5f, ImVec2(ImGui::GetFontSize() * 25, 0.0f));
+            ImGui::RequestWakeup();
             ImGui::EndTooltip();
         }
 
@@ -8180,12 +8198,17 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigMemoryHibernateTimer >= 0.0f)                      ImGui::Text("io.ConfigMemoryHibernateTimer = %.1f", io.ConfigMemoryHibernateTimer);
+        if (io.ConfigDrawDataMergeDrawLists)                            ImGui::Text("io.ConfigDrawDataMergeDrawLists");
+        if (io.ConfigDrawDataFingerprint)                               ImGui::Text("io.ConfigDrawDataFingerprint");
+        if (io.ConfigDrawListRectInstances)                             ImGui::Text("io.ConfigDrawListRectInstances");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasTextures)    ImGui::Text(" RendererHasTextures");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances) ImGui::Text(" RendererHasRectInstances");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexData->Width, io.Fonts->TexData->Height);
         ImGui::Text("io.Fonts->FontLoaderName: %s", io.Fonts->FontLoaderName ? io.Fonts->FontLoaderName : "NULL");
@@ -9780,6 +9803,7 @@ static void ShowExampleAppWindowTitles(bool*)
     // Using "###" to display a changing title but keep a static identifier "AnimatedTitle"
     char buf[128];
     sprintf(buf, "Animated title %c %d###AnimatedTitle", "|/-\\"[(int)(ImGui::GetTime() / 0.25f) & 3], ImGui::GetFrameCount());
+    ImGui::RequestWakeup(0.25f - fmodf((float)ImGui::GetTime(), 0.25f));
     ImGui::SetNextWindowPos(ImVec2(base_pos.x + 100, base_pos.y + 300), ImGuiCond_FirstUseEver);
     ImGui::Begin(buf);
     ImGui::Text("This window has a changing title.");
@@ -448,6 +448,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    RectBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -460,6 +461,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = _Data->InitialFringeScale;
+    _Fingerprint = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -467,6 +469,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    RectBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -476,6 +479,7 @@ void ImDrawList::_ClearFreeMemory()
     _CallbacksDataBuf.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _Fingerprint = 0;
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -484,6 +488,7 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->RectBuffer = RectBuffer;
     dst->Flags = Flags;
     return dst;
 }
@@ -495,6 +500,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.TexRef = _CmdHeader.TexRef;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.RectOffset = RectBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -507,7 +513,7 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0 || curr_cmd->UserCallback != NULL)
             return;// break;
         CmdBuffer.pop_back();
     }
@@ -518,7 +524,7 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -547,21 +553,98 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
+// Append the output of another draw list (e.g. from another context's ImDrawData), translated by 'offset' and clipped by our current clip rectangle.
+// - Only the range of vertices referenced by each command is copied, and indices are rebased, so VtxOffset/16-bit indices limits are handled as usual by PrimReserve().
+// - Rect instances are converted to quads if we don't have ImDrawListFlags_AllowRectInstances.
+// - Callbacks are copied along with their user data.
+void ImDrawList::AddDrawList(const ImDrawList* src_list, const ImVec2& offset)
+{
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    for (const ImDrawCmd& src_cmd : src_list->CmdBuffer)
+    {
+        if (src_cmd.UserCallback != NULL)
+        {
+            void* userdata = (src_cmd.UserCallbackDataSize > 0) ? src_list->_CallbacksDataBuf.Data + src_cmd.UserCallbackDataOffset : src_cmd.UserCallbackData;
+            AddCallback(src_cmd.UserCallback, userdata, (size_t)src_cmd.UserCallbackDataSize);
+            continue;
+        }
+        const ImVec2 cmd_clip_min(ImMax(src_cmd.ClipRect.x + offset.x, clip_rect.x), ImMax(src_cmd.ClipRect.y + offset.y, clip_rect.y));
+        const ImVec2 cmd_clip_max(ImMin(src_cmd.ClipRect.z + offset.x, clip_rect.z), ImMin(src_cmd.ClipRect.w + offset.y, clip_rect.w));
+        if (cmd_clip_min.x >= cmd_clip_max.x || cmd_clip_min.y >= cmd_clip_max.y || (src_cmd.ElemCount == 0 && src_cmd.RectCount == 0))
+            continue;
+        PushClipRect(cmd_clip_min, cmd_clip_max);
+        PushTexture(src_cmd.TexRef);
+
+        if (src_cmd.ElemCount > 0)
+        {
+            const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd.IdxOffset;
+            unsigned int idx_min = (unsigned int)src_idx[0], idx_max = (unsigned int)src_idx[0];
+            for (unsigned int n = 1; n < src_cmd.ElemCount; n++)
+            {
+                idx_min = ImMin(idx_min, (unsigned int)src_idx[n]);
+                idx_max = ImMax(idx_max, (unsigned int)src_idx[n]);
+            }
+            const int vtx_count = (int)(idx_max - idx_min + 1);
+            PrimReserve((int)src_cmd.ElemCount, vtx_count);
+            const ImDrawVert* src_vtx = src_list->VtxBuffer.Data + src_cmd.VtxOffset + idx_min;
+            for (int n = 0; n < vtx_count; n++)
+            {
+                _VtxWritePtr[n] = src_vtx[n];
+                _VtxWritePtr[n].pos = ImVec2(src_vtx[n].pos.x + offset.x, src_vtx[n].pos.y + offset.y);
+            }
+            for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                _IdxWritePtr[n] = (ImDrawIdx)(_VtxCurrentIdx + src_idx[n] - idx_min);
+            _VtxWritePtr += vtx_count;
+            _IdxWritePtr += src_cmd.ElemCount;
+            _VtxCurrentIdx += (unsigned int)vtx_count;
+        }
+        if (src_cmd.RectCount > 0)
+        {
+            const ImDrawRectInstance* src_rect = src_list->RectBuffer.Data + src_cmd.RectOffset;
+            if (Flags & ImDrawListFlags_AllowRectInstances)
+            {
+                ImDrawRectInstance* dst_rect = PrimReserveRects((int)src_cmd.RectCount);
+                for (unsigned int n = 0; n < src_cmd.RectCount; n++, dst_rect++, src_rect++)
+                {
+                    *dst_rect = *src_rect;
+                    dst_rect->PosMin += offset;
+                    dst_rect->PosMax += offset;
+                }
+            }
+            else
+            {
+                PrimReserve((int)src_cmd.RectCount * 6, (int)src_cmd.RectCount * 4);
+                for (unsigned int n = 0; n < src_cmd.RectCount; n++, src_rect++)
+                    PrimRectUV(src_rect->PosMin + offset, src_rect->PosMax + offset, src_rect->UvMin, src_rect->UvMax, src_rect->Col);
+            }
+        }
+
+        PopTexture();
+        PopClipRect();
+    }
+}
+
 // Compare ClipRect, TexRef and VtxOffset with a single memcmp()
 #define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TexRef, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TexRef, VtxOffset
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
 
+// A command holds either triangles or rect instances: CMD_1 can be appended to CMD_0 if it is empty, or if both hold the same kind of primitives.
+// Rect instances need to be contiguous in RectBuffer[]. Each channel of a ImDrawListSplitter owns its RectBuffer[] (like IdxBuffer[]), which Merge() concatenates and rebases RectOffset for.
+#define ImDrawCmd_AreCompatibleKinds(CMD_0, CMD_1)      ((CMD_1)->RectCount == 0 ? ((CMD_1)->ElemCount == 0 || (CMD_0)->RectCount == 0) : ((CMD_0)->ElemCount == 0 && ((CMD_0)->RectCount == 0 || (CMD_0)->RectOffset + (CMD_0)->RectCount == (CMD_1)->RectOffset)))
+#define ImDrawCmd_MergeRects(CMD_DST, CMD_SRC)          { if ((CMD_SRC)->RectCount != 0) { if ((CMD_DST)->RectCount == 0) (CMD_DST)->RectOffset = (CMD_SRC)->RectOffset; (CMD_DST)->RectCount += (CMD_SRC)->RectCount; } } (void)0
+
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
 {
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreCompatibleKinds(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
+        ImDrawCmd_MergeRects(prev_cmd, curr_cmd);
         CmdBuffer.pop_back();
     }
 }
@@ -573,7 +656,7 @@ void ImDrawList::_OnChangedClipRect()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
         AddDrawCmd();
         return;
@@ -582,7 +665,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -595,7 +678,7 @@ void ImDrawList::_OnChangedTexture()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TexRef != _CmdHeader.TexRef)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0) && curr_cmd->TexRef != _CmdHeader.TexRef)
     {
         AddDrawCmd();
         return;
@@ -607,7 +690,7 @@ void ImDrawList::_OnChangedTexture()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -622,7 +705,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0)
     {
         AddDrawCmd();
         return;
@@ -697,6 +780,7 @@ void ImDrawList::_SetTexture(ImTextureRef tex_ref)
     _CmdHeader.TexRef = tex_ref;
     _TextureStack.back() = tex_ref;
     _OnChangedTexture();
+    _Fingerprint = 0; // May be called on a draw list reused from previous frame when an atlas texture is replaced (see ImFontAtlasUpdateDrawListsTextures())
 }
 
 // Reserve space for a number of vertices and indices.
@@ -716,6 +800,11 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     }
 
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->RectCount != 0)
+    {
+        AddDrawCmd(); // Current command is holding rect instances
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
@@ -738,6 +827,61 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// Starting a run of rect instances after triangles (or the opposite) requires a new draw command.
+// Single rectangles follow the kind of the current command, only runs of at least IM_DRAWLIST_RECT_INSTANCES_MIN_RUN rectangles may switch to rect instances.
+#ifndef IM_DRAWLIST_RECT_INSTANCES_MIN_RUN
+#define IM_DRAWLIST_RECT_INSTANCES_MIN_RUN      32
+#endif
+
+static inline bool ImDrawList_UseRectInstances(const ImDrawList* draw_list, int rect_count)
+{
+    if (!(draw_list->Flags & ImDrawListFlags_AllowRectInstances))
+        return false;
+    const ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+    return curr_cmd->ElemCount == 0 || rect_count >= IM_DRAWLIST_RECT_INSTANCES_MIN_RUN;
+}
+
+// Reserve space for a number of rect instances (only when ImDrawListFlags_AllowRectInstances is set).
+// - Rect instances are stored in their own commands, as we need to preserve ordering with triangles.
+// - Unlike PrimReserve(), the returned pointer is invalidated by any further call to PrimReserveRects() or PrimRectInstance().
+ImDrawRectInstance* ImDrawList::PrimReserveRects(int rect_count)
+{
+    IM_ASSERT_PARANOID(rect_count >= 0);
+    IM_ASSERT_PARANOID(Flags & ImDrawListFlags_AllowRectInstances);
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->ElemCount != 0)
+    {
+        AddDrawCmd(); // Current command is holding triangles
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
+    if (draw_cmd->RectCount == 0)
+        draw_cmd->RectOffset = RectBuffer.Size;
+    draw_cmd->RectCount += rect_count;
+
+    int rect_buffer_old_size = RectBuffer.Size;
+    RectBuffer.resize(rect_buffer_old_size + rect_count);
+    return RectBuffer.Data + rect_buffer_old_size;
+}
+
+// Release the number of reserved rect instances from the end of the last reservation made with PrimReserveRects().
+void ImDrawList::PrimUnreserveRects(int rect_count)
+{
+    IM_ASSERT_PARANOID(rect_count >= 0);
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    draw_cmd->RectCount -= rect_count;
+    RectBuffer.shrink(RectBuffer.Size - rect_count);
+}
+
+void ImDrawList::PrimRectInstance(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col)
+{
+    ImDrawRectInstance* rect = PrimReserveRects(1);
+    rect->PosMin = a;
+    rect->PosMax = c;
+    rect->UvMin = uv_a;
+    rect->UvMax = uv_c;
+    rect->Col = col;
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -790,6 +934,48 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Decimate a dense polyline for ImDrawFlags_Decimate: merge runs of consecutive points falling in the same 'column_width' wide column
+// into (up to) 4 points: first, lowest, highest, last. The rasterized line is preserved when 'column_width' is about one pixel,
+// and the output is bounded by the number of columns crossed by the line, regardless of the number of input points.
+// This is the same idea as the "M4" aggregation used by plotting libraries. Return number of points written to 'out_points' (<= points_count).
+static int PolylineDecimate(const ImVec2* points, int points_count, float column_width, ImVec2* out_points)
+{
+    const float column_width_inv = 1.0f / column_width;
+    int out_count = 0;
+    int run_start = 0, run_min = 0, run_max = 0;
+    float run_column = ImFloor(points[0].x * column_width_inv);
+    for (int i = 1; i <= points_count; i++)
+    {
+        if (i < points_count)
+        {
+            const float column = ImFloor(points[i].x * column_width_inv);
+            if (column == run_column)
+            {
+                if (points[i].y < points[run_min].y)
+                    run_min = i;
+                if (points[i].y > points[run_max].y)
+                    run_max = i;
+                continue;
+            }
+            run_column = column;
+        }
+
+        // Output run [run_start, i - 1] in original order, skipping duplicates
+        const int run_last = i - 1;
+        const int run_mid_1 = ImMin(run_min, run_max);
+        const int run_mid_2 = ImMax(run_min, run_max);
+        out_points[out_count++] = points[run_start];
+        if (run_mid_1 != run_start && run_mid_1 != run_last)
+            out_points[out_count++] = points[run_mid_1];
+        if (run_mid_2 != run_mid_1 && run_mid_2 != run_start && run_mid_2 != run_last)
+            out_points[out_count++] = points[run_mid_2];
+        if (run_last != run_start)
+            out_points[out_count++] = points[run_last];
+        run_start = run_min = run_max = i;
+    }
+    return out_count;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -797,6 +983,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
 
+    // Decimate dense polylines so the geometry we generate is bounded by on-screen resolution
+    if ((flags & ImDrawFlags_Decimate) && points_count > 4)
+    {
+        IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
+        _Data->TempBuffer.reserve_discard(points_count);
+        const int decimated_count = PolylineDecimate(points, points_count, _Data->CurveTessellationTol, _Data->TempBuffer.Data);
+        AddPolyline(_Data->TempBuffer.Data, decimated_count, col, flags & ~ImDrawFlags_Decimate, thickness);
+        return;
+    }
+
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
@@ -825,24 +1021,19 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
         PrimReserve(idx_count, vtx_count);
 
-        // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
-
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        // Normals (tangents) of line segments are computed once and carried over to the next point, vertices are emitted directly.
+        // - For a closed line, the first point blends the normal of the last segment (last point -> first point) with the normal of the first segment.
+        // - For an open line, the first point uses the normal of the first segment, the last point reuses the normal of the last segment.
+        float prev_n_x, prev_n_y; // Normal of the segment ending at the current point
         {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+            const int i1 = closed ? points_count - 1 : 0;
+            const int i2 = closed ? 0 : 1;
             float dx = points[i2].x - points[i1].x;
             float dy = points[i2].y - points[i1].y;
             IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            prev_n_x = dy;
+            prev_n_y = -dx;
         }
-        if (!closed)
-            temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -856,39 +1047,74 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+            const int vtx_stride = use_texture ? 2 : 3;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+            // If we're using textures we only need to emit the left/right edge vertices
+            ImVec4 tex_uvs = _Data->TexUvLines[use_texture ? integer_thickness : 0];
+            /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
             {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+                const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
+                tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+                tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+                tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+                tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+            }*/
+            const ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+            const ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+
+            // Generate the vertices for the line edges at each point, and the indices to form a number of triangles for the line segment ending at this point.
+            // The extra iteration (i == points_count) adds the segment from the last point to the first point of a closed line.
+            const unsigned int idx_base = _VtxCurrentIdx;
+            for (int i = 0; i <= points_count; i++)
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
+                if (i < points_count)
+                {
+                    // Normal of the segment starting at this point
+                    float n_x = prev_n_x, n_y = prev_n_y;
+                    if (i < count)
+                    {
+                        const int i2 = (i + 1) == points_count ? 0 : i + 1;
+                        float dx = points[i2].x - points[i].x;
+                        float dy = points[i2].y - points[i].y;
+                        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                        n_x = dy;
+                        n_y = -dx;
+                    }
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
+                    // Average normals (the first point of an open line has no normals to blend)
+                    float dm_x = n_x, dm_y = n_y;
+                    if (closed || i > 0)
+                    {
+                        dm_x = (prev_n_x + n_x) * 0.5f;
+                        dm_y = (prev_n_y + n_y) * 0.5f;
+                        IM_FIXNORMAL2F(dm_x, dm_y);
+                    }
+                    dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                    dm_y *= half_draw_size;
+                    prev_n_x = n_x;
+                    prev_n_y = n_y;
 
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
+                    // Add vertices for the outer edges
+                    if (use_texture)
+                    {
+                        _VtxWritePtr[0].pos.x = points[i].x + dm_x; _VtxWritePtr[0].pos.y = points[i].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                        _VtxWritePtr[1].pos.x = points[i].x - dm_x; _VtxWritePtr[1].pos.y = points[i].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                        _VtxWritePtr += 2;
+                    }
+                    else
+                    {
+                        // If we're not using a texture, we need the center vertex as well
+                        _VtxWritePtr[0].pos = points[i];                                                        _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                        _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                        _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                        _VtxWritePtr += 3;
+                    }
+                }
 
+                if (i == 0 || (i == points_count && !closed))
+                    continue;
+                const unsigned int idx1 = idx_base + (i - 1) * vtx_stride;                   // Vertex index for start of line segment
+                const unsigned int idx2 = (i == points_count) ? idx_base : (idx1 + vtx_stride); // Vertex index for end of segment
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -905,91 +1131,60 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
                     _IdxWritePtr += 12;
                 }
-
-                idx1 = idx2;
-            }
-
-            // Add vertices for each point on the line
-            if (use_texture)
-            {
-                // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }*/
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
-            }
-            else
-            {
-                // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
-                }
             }
         }
         else
         {
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            const float half_outer_thickness = half_inner_thickness + AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+            // Generate the vertices for the line edges at each point, and the indices to form a number of triangles for the line segment ending at this point.
+            // The extra iteration (i == points_count) adds the segment from the last point to the first point of a closed line.
+            const unsigned int idx_base = _VtxCurrentIdx;
+            for (int i = 0; i <= points_count; i++)
             {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
+                if (i < points_count)
+                {
+                    // Normal of the segment starting at this point
+                    float n_x = prev_n_x, n_y = prev_n_y;
+                    if (i < count)
+                    {
+                        const int i2 = (i + 1) == points_count ? 0 : i + 1;
+                        float dx = points[i2].x - points[i].x;
+                        float dy = points[i2].y - points[i].y;
+                        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                        n_x = dy;
+                        n_y = -dx;
+                    }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
+                    // Average normals (the first point of an open line has no normals to blend)
+                    float dm_x = n_x, dm_y = n_y;
+                    if (closed || i > 0)
+                    {
+                        dm_x = (prev_n_x + n_x) * 0.5f;
+                        dm_y = (prev_n_y + n_y) * 0.5f;
+                        IM_FIXNORMAL2F(dm_x, dm_y);
+                    }
+                    const float dm_out_x = dm_x * half_outer_thickness;
+                    const float dm_out_y = dm_y * half_outer_thickness;
+                    const float dm_in_x = dm_x * half_inner_thickness;
+                    const float dm_in_y = dm_y * half_inner_thickness;
+                    prev_n_x = n_x;
+                    prev_n_y = n_y;
+
+                    // Add vertices
+                    _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                    _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                    _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                    _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                    _VtxWritePtr += 4;
+                }
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
+                if (i == 0 || (i == points_count && !closed))
+                    continue;
+                const unsigned int idx1 = idx_base + (i - 1) * 4;                            // Vertex index for start of line segment
+                const unsigned int idx2 = (i == points_count) ? idx_base : (idx1 + 4);      // Vertex index for end of segment
 
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
@@ -999,25 +1194,137 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
                 _IdxWritePtr += 18;
+            }
+        }
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else if (flags & ImDrawFlags_JoinMask_)
+    {
+        // [PATH 4] Non texture-based, Non anti-aliased lines, with joins: vertices are shared between consecutive segments.
+        // - Miter joins use 2 vertices per point. Sharp angles (exceeding MITER_LIMIT) fall back to bevel joins.
+        // - Bevel joins use 3 vertices per point: one shared vertex on the inner side of the turn, two on the outer side + 1 triangle to fill the gap.
+        // We reserve for the worst case (bevel everywhere) and release the unused part at the end.
+        const float MITER_LIMIT = 4.0f; // Maximum ratio between miter length and half thickness (same as SVG's default 'stroke-miterlimit')
+        const float miter_min_len2 = 1.0f / (MITER_LIMIT * MITER_LIMIT);
+        const bool join_miter = (flags & ImDrawFlags_JoinMiter) != 0;
+        const float half_thickness = thickness * 0.5f;
+        const int idx_count_max = count * 6 + points_count * 3;
+        const int vtx_count_max = points_count * 3;
+        PrimReserve(idx_count_max, vtx_count_max);
+        ImDrawVert* vtx_write_start = _VtxWritePtr;
+        ImDrawIdx* idx_write_start = _IdxWritePtr;
+
+        float prev_n_x, prev_n_y; // Normal of the segment ending at the current point
+        {
+            const int i1 = closed ? points_count - 1 : 0;
+            const int i2 = closed ? 0 : 1;
+            float dx = points[i2].x - points[i1].x;
+            float dy = points[i2].y - points[i1].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            prev_n_x = dy;
+            prev_n_y = -dx;
+        }
 
-                idx1 = idx2;
+        unsigned int idx = _VtxCurrentIdx;
+        unsigned int prev_start_l = 0, prev_start_r = 0;    // Vertices starting the segment ending at the current point
+        unsigned int first_end_l = 0, first_end_r = 0;      // Vertices ending the closing segment, for closed lines
+        for (int i = 0; i < points_count; i++)
+        {
+            // Normal of the segment starting at this point
+            float n_x = prev_n_x, n_y = prev_n_y;
+            if (i < count)
+            {
+                const int i2 = (i + 1) == points_count ? 0 : i + 1;
+                float dx = points[i2].x - points[i].x;
+                float dy = points[i2].y - points[i].y;
+                IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                n_x = dy;
+                n_y = -dx;
             }
 
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
+            const ImVec2 p = points[i];
+            unsigned int end_l, end_r, start_l, start_r;
+            const bool is_joint = closed || (i > 0 && i < points_count - 1);
+            const float cross = prev_n_x * n_y - prev_n_y * n_x;
+            float dm_x = (prev_n_x + n_x) * 0.5f;
+            float dm_y = (prev_n_y + n_y) * 0.5f;
+            const float dm_len2 = dm_x * dm_x + dm_y * dm_y;
+            if (!is_joint || ((join_miter || cross == 0.0f) && dm_len2 >= miter_min_len2))
+            {
+                // Miter join (or end point): 2 shared vertices
+                if (is_joint)
+                {
+                    IM_FIXNORMAL2F(dm_x, dm_y);
+                }
+                else
+                {
+                    dm_x = n_x;
+                    dm_y = n_y;
+                }
+                dm_x *= half_thickness;
+                dm_y *= half_thickness;
+                _VtxWritePtr[0].pos.x = p.x + dm_x; _VtxWritePtr[0].pos.y = p.y + dm_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = p.x - dm_x; _VtxWritePtr[1].pos.y = p.y - dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr += 2;
+                end_l = start_l = idx;
+                end_r = start_r = idx + 1;
+                idx += 2;
+            }
+            else
+            {
+                // Bevel join: the inner side of the turn shares the miter vertex, the outer side has one vertex for each segment.
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                dm_x *= half_thickness;
+                dm_y *= half_thickness;
+                const float outer_sign = (cross > 0.0f) ? +1.0f : -1.0f; // Which side of the line is the outer side
+                _VtxWritePtr[0].pos.x = p.x - dm_x * outer_sign; _VtxWritePtr[0].pos.y = p.y - dm_y * outer_sign; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col; // Inner
+                _VtxWritePtr[1].pos.x = p.x + prev_n_x * half_thickness * outer_sign; _VtxWritePtr[1].pos.y = p.y + prev_n_y * half_thickness * outer_sign; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col; // Outer, previous segment
+                _VtxWritePtr[2].pos.x = p.x + n_x * half_thickness * outer_sign; _VtxWritePtr[2].pos.y = p.y + n_y * half_thickness * outer_sign; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col; // Outer, next segment
+                _VtxWritePtr += 3;
+                if (outer_sign > 0.0f)
+                {
+                    end_l = idx + 1; start_l = idx + 2;
+                    end_r = start_r = idx;
+                }
+                else
+                {
+                    end_r = idx + 1; start_r = idx + 2;
+                    end_l = start_l = idx;
+                }
+                _IdxWritePtr[0] = (ImDrawIdx)(idx); _IdxWritePtr[1] = (ImDrawIdx)(idx + 1); _IdxWritePtr[2] = (ImDrawIdx)(idx + 2);
+                _IdxWritePtr += 3;
+                idx += 3;
+            }
+            prev_n_x = n_x;
+            prev_n_y = n_y;
+
+            // Add indices for the segment ending at this point
+            if (i == 0)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
+                first_end_l = end_l;
+                first_end_r = end_r;
             }
+            else
+            {
+                _IdxWritePtr[0] = (ImDrawIdx)(prev_start_l); _IdxWritePtr[1] = (ImDrawIdx)(end_l); _IdxWritePtr[2] = (ImDrawIdx)(end_r);
+                _IdxWritePtr[3] = (ImDrawIdx)(prev_start_l); _IdxWritePtr[4] = (ImDrawIdx)(end_r); _IdxWritePtr[5] = (ImDrawIdx)(prev_start_r);
+                _IdxWritePtr += 6;
+            }
+            prev_start_l = start_l;
+            prev_start_r = start_r;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        if (closed)
+        {
+            _IdxWritePtr[0] = (ImDrawIdx)(prev_start_l); _IdxWritePtr[1] = (ImDrawIdx)(first_end_l); _IdxWritePtr[2] = (ImDrawIdx)(first_end_r);
+            _IdxWritePtr[3] = (ImDrawIdx)(prev_start_l); _IdxWritePtr[4] = (ImDrawIdx)(first_end_r); _IdxWritePtr[5] = (ImDrawIdx)(prev_start_r);
+            _IdxWritePtr += 6;
+        }
+        _VtxCurrentIdx = idx;
+        PrimUnreserve(idx_count_max - (int)(_IdxWritePtr - idx_write_start), vtx_count_max - (int)(_VtxWritePtr - vtx_write_start));
     }
     else
     {
-        // [PATH 4] Non texture-based, Non anti-aliased lines
+        // [PATH 5] Non texture-based, Non anti-aliased lines, without joins
         const int idx_count = count * 6;
         const int vtx_count = count * 4;    // FIXME-OPT: Not sharing edges
         PrimReserve(idx_count, vtx_count);
@@ -1498,6 +1805,11 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
+        if (ImDrawList_UseRectInstances(this, 1))
+        {
+            PrimRectInstance(p_min, p_max, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col);
+            return;
+        }
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
@@ -1693,6 +2005,318 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
     PathStroke(col, 0, thickness);
 }
 
+//-----------------------------------------------------------------------------
+// Batched primitives
+//-----------------------------------------------------------------------------
+// - Geometry is reserved once per chunk of items and written in a tight loop, with write pointers kept in locals.
+// - Chunks are bounded to IM_DRAWLIST_BATCH_VTX_MAX vertices so each reservation fits in 16-bit indices.
+// - Fully transparent items are skipped, the unused part of a chunk reservation is released at the end of the chunk.
+//-----------------------------------------------------------------------------
+
+#define IM_DRAWLIST_BATCH_VTX_MAX               16384
+#define IM_DRAWLIST_BATCH_COL(_COLS,_STRIDE,_N) (*(const ImU32*)(const void*)((const char*)(_COLS) + (size_t)(_N) * (size_t)(_STRIDE)))
+
+// Same output as calling AddRectFilled() with no rounding for each item.
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count, int cols_stride)
+{
+    IM_ASSERT(count <= 0 || (p_min != NULL && p_max != NULL && cols != NULL));
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    if (ImDrawList_UseRectInstances(this, count))
+    {
+        ImDrawRectInstance* rect_write_start = PrimReserveRects(count);
+        ImDrawRectInstance* rect_write = rect_write_start;
+        for (int n = 0; n < count; n++)
+        {
+            const ImU32 col = IM_DRAWLIST_BATCH_COL(cols, cols_stride, n);
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            rect_write->PosMin = p_min[n];
+            rect_write->PosMax = p_max[n];
+            rect_write->UvMin = rect_write->UvMax = uv;
+            rect_write->Col = col;
+            rect_write++;
+        }
+        PrimUnreserveRects(count - (int)(rect_write - rect_write_start));
+        return;
+    }
+    for (int chunk_start = 0; chunk_start < count; )
+    {
+        const int chunk_end = ImMin(count, chunk_start + IM_DRAWLIST_BATCH_VTX_MAX / 4);
+        const int chunk_count = chunk_end - chunk_start;
+        PrimReserve(chunk_count * 6, chunk_count * 4);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 col = IM_DRAWLIST_BATCH_COL(cols, cols_stride, n);
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2 a = p_min[n];
+            const ImVec2 c = p_max[n];
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos.x = a.x; vtx_write[0].pos.y = a.y; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write[1].pos.x = c.x; vtx_write[1].pos.y = a.y; vtx_write[1].uv = uv; vtx_write[1].col = col;
+            vtx_write[2].pos.x = c.x; vtx_write[2].pos.y = c.y; vtx_write[2].uv = uv; vtx_write[2].col = col;
+            vtx_write[3].pos.x = a.x; vtx_write[3].pos.y = c.y; vtx_write[3].uv = uv; vtx_write[3].col = col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        PrimUnreserve(chunk_count * 6 - (int)(idx_write - _IdxWritePtr), chunk_count * 4 - (int)(vtx_write - _VtxWritePtr));
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        chunk_start = chunk_end;
+    }
+}
+
+// Number of points for a filled circle in AddCircleFilledBatch(): same count as AddCircleFilled().
+static inline int ImDrawList_CalcCircleFilledBatchSegments(const ImDrawList* draw_list, float radius, int num_segments)
+{
+    if (num_segments > 0)
+        return num_segments;
+    const int a_step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / draw_list->_CalcCircleAutoSegmentCount(radius), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+    return IM_DRAWLIST_ARCFAST_SAMPLE_MAX / a_step + ((IM_DRAWLIST_ARCFAST_SAMPLE_MAX % a_step) ? 1 : 0);
+}
+
+// Circles are emitted as evenly spaced regular polygons, using the same number of points as AddCircleFilled().
+// The unit circle is cached for the current segment count: since vertices lie on it, the averaged edge normals
+// computed by AddConvexPolyFilled() for the anti-aliasing fringe are the unit vectors themselves, scaled by 1/cos(PI/N).
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments, int cols_stride)
+{
+    IM_ASSERT(count <= 0 || (centers != NULL && radii != NULL && cols != NULL));
+    if (num_segments > 0)
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX); // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    ImVector<ImVec2>& unit_circle = _Data->TempBuffer;
+    int unit_circle_segments = 0;
+    float aa_offset = 0.0f;
+
+    for (int chunk_start = 0; chunk_start < count; )
+    {
+        // Measure chunk
+        int chunk_end = chunk_start;
+        int vtx_count = 0, idx_count = 0;
+        while (chunk_end < count)
+        {
+            const int segments = ImDrawList_CalcCircleFilledBatchSegments(this, radii[chunk_end], num_segments);
+            const int item_vtx_count = anti_aliased ? segments * 2 : segments;
+            if (vtx_count + item_vtx_count > IM_DRAWLIST_BATCH_VTX_MAX && chunk_end > chunk_start)
+                break;
+            vtx_count += item_vtx_count;
+            idx_count += anti_aliased ? (segments - 2) * 3 + segments * 6 : (segments - 2) * 3;
+            chunk_end++;
+        }
+        PrimReserve(idx_count, vtx_count);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 col = IM_DRAWLIST_BATCH_COL(cols, cols_stride, n);
+            const float radius = radii[n];
+            if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
+                continue;
+
+            const int segments = ImDrawList_CalcCircleFilledBatchSegments(this, radius, num_segments);
+            if (segments != unit_circle_segments)
+            {
+                unit_circle.reserve_discard(segments);
+                for (int i = 0; i < segments; i++)
+                {
+                    const float a = ((float)i * 2.0f * IM_PI) / (float)segments;
+                    unit_circle.Data[i] = ImVec2(ImCos(a), ImSin(a));
+                }
+                unit_circle_segments = segments;
+                aa_offset = _FringeScale * 0.5f / ImCos(IM_PI / (float)segments);
+            }
+            const ImVec2 center = centers[n];
+            const ImVec2* unit = unit_circle.Data;
+
+            if (anti_aliased)
+            {
+                // Anti-aliased Fill (same layout as AddConvexPolyFilled(): inner/outer vertex pairs)
+                const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+                const float r_inner = radius - aa_offset;
+                const float r_outer = radius + aa_offset;
+                for (int i = 2; i < segments; i++)
+                {
+                    idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(idx + (i << 1));
+                    idx_write += 3;
+                }
+                for (int i0 = segments - 1, i1 = 0; i1 < segments; i0 = i1++)
+                {
+                    vtx_write[0].pos.x = center.x + unit[i1].x * r_inner; vtx_write[0].pos.y = center.y + unit[i1].y * r_inner; vtx_write[0].uv = uv; vtx_write[0].col = col;       // Inner
+                    vtx_write[1].pos.x = center.x + unit[i1].x * r_outer; vtx_write[1].pos.y = center.y + unit[i1].y * r_outer; vtx_write[1].uv = uv; vtx_write[1].col = col_trans; // Outer
+                    vtx_write += 2;
+                    idx_write[0] = (ImDrawIdx)(idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(idx + (i0 << 1) + 1);
+                    idx_write[3] = (ImDrawIdx)(idx + (i0 << 1) + 1); idx_write[4] = (ImDrawIdx)(idx + (i1 << 1) + 1); idx_write[5] = (ImDrawIdx)(idx + (i1 << 1));
+                    idx_write += 6;
+                }
+                idx += segments * 2;
+            }
+            else
+            {
+                // Non Anti-aliased Fill
+                for (int i = 0; i < segments; i++)
+                {
+                    vtx_write[0].pos.x = center.x + unit[i].x * radius; vtx_write[0].pos.y = center.y + unit[i].y * radius; vtx_write[0].uv = uv; vtx_write[0].col = col;
+                    vtx_write++;
+                }
+                for (int i = 2; i < segments; i++)
+                {
+                    idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + i - 1); idx_write[2] = (ImDrawIdx)(idx + i);
+                    idx_write += 3;
+                }
+                idx += segments;
+            }
+        }
+        PrimUnreserve(idx_count - (int)(idx_write - _IdxWritePtr), vtx_count - (int)(vtx_write - _VtxWritePtr));
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        chunk_start = chunk_end;
+    }
+}
+
+// Same output as calling AddLine() for each item: this is the 2 points case of the AddPolyline() paths, with a single normal per line.
+void ImDrawList::AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness, int cols_stride)
+{
+    IM_ASSERT(count <= 0 || (p1 != NULL && p2 != NULL && cols != NULL));
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const float AA_SIZE = _FringeScale;
+
+    // Select path, same as AddPolyline()
+    enum { Path_Tex, Path_Thin, Path_Thick, Path_NoAA };
+    int path = Path_NoAA;
+    float half_draw_size = 0.0f, half_inner_thickness = 0.0f, half_outer_thickness = 0.0f;
+    ImVec2 tex_uv0, tex_uv1;
+    if (anti_aliased)
+    {
+        const bool thick_line = (thickness > AA_SIZE);
+        thickness = ImMax(thickness, 1.0f);
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - integer_thickness;
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        path = use_texture ? Path_Tex : thick_line ? Path_Thick : Path_Thin;
+        half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+        half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        half_outer_thickness = half_inner_thickness + AA_SIZE;
+        const ImVec4 tex_uvs = _Data->TexUvLines[use_texture ? integer_thickness : 0];
+        tex_uv0 = ImVec2(tex_uvs.x, tex_uvs.y);
+        tex_uv1 = ImVec2(tex_uvs.z, tex_uvs.w);
+    }
+    const int vtx_per_line = (path == Path_Thin) ? 6 : (path == Path_Thick) ? 8 : 4;
+    const int idx_per_line = (path == Path_Thin) ? 12 : (path == Path_Thick) ? 18 : 6;
+
+    for (int chunk_start = 0; chunk_start < count; )
+    {
+        const int chunk_end = ImMin(count, chunk_start + IM_DRAWLIST_BATCH_VTX_MAX / vtx_per_line);
+        const int chunk_count = chunk_end - chunk_start;
+        PrimReserve(chunk_count * idx_per_line, chunk_count * vtx_per_line);
+
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 col = IM_DRAWLIST_BATCH_COL(cols, cols_stride, n);
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2 a(p1[n].x + 0.5f, p1[n].y + 0.5f);
+            const ImVec2 b(p2[n].x + 0.5f, p2[n].y + 0.5f);
+            float dx = b.x - a.x;
+            float dy = b.y - a.y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+
+            if (path == Path_NoAA)
+            {
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                vtx_write[0].pos.x = a.x + dy; vtx_write[0].pos.y = a.y - dx; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos.x = b.x + dy; vtx_write[1].pos.y = b.y - dx; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write[2].pos.x = b.x - dy; vtx_write[2].pos.y = b.y + dx; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                vtx_write[3].pos.x = a.x - dy; vtx_write[3].pos.y = a.y + dx; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col;
+                idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+                idx_write[3] = (ImDrawIdx)(idx); idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            }
+            else
+            {
+                // Offsets of the start point (segment normal) and end point (normal averaged with itself, as AddPolyline() does)
+                const float n_x = dy, n_y = -dx;
+                float dm_x = n_x, dm_y = n_y;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                const unsigned int idx1 = idx;
+                const unsigned int idx2 = idx + vtx_per_line / 2;
+                if (path == Path_Tex)
+                {
+                    const float d0_x = n_x * half_draw_size, d0_y = n_y * half_draw_size;
+                    const float d1_x = dm_x * half_draw_size, d1_y = dm_y * half_draw_size;
+                    vtx_write[0].pos.x = a.x + d0_x; vtx_write[0].pos.y = a.y + d0_y; vtx_write[0].uv = tex_uv0; vtx_write[0].col = col;
+                    vtx_write[1].pos.x = a.x - d0_x; vtx_write[1].pos.y = a.y - d0_y; vtx_write[1].uv = tex_uv1; vtx_write[1].col = col;
+                    vtx_write[2].pos.x = b.x + d1_x; vtx_write[2].pos.y = b.y + d1_y; vtx_write[2].uv = tex_uv0; vtx_write[2].col = col;
+                    vtx_write[3].pos.x = b.x - d1_x; vtx_write[3].pos.y = b.y - d1_y; vtx_write[3].uv = tex_uv1; vtx_write[3].col = col;
+                    idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1);
+                    idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+                }
+                else if (path == Path_Thin)
+                {
+                    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+                    const float d0_x = n_x * half_draw_size, d0_y = n_y * half_draw_size;
+                    const float d1_x = dm_x * half_draw_size, d1_y = dm_y * half_draw_size;
+                    vtx_write[0].pos = a;                                                 vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                    vtx_write[1].pos.x = a.x + d0_x; vtx_write[1].pos.y = a.y + d0_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans;
+                    vtx_write[2].pos.x = a.x - d0_x; vtx_write[2].pos.y = a.y - d0_y; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans;
+                    vtx_write[3].pos = b;                                                 vtx_write[3].uv = opaque_uv; vtx_write[3].col = col;
+                    vtx_write[4].pos.x = b.x + d1_x; vtx_write[4].pos.y = b.y + d1_y; vtx_write[4].uv = opaque_uv; vtx_write[4].col = col_trans;
+                    vtx_write[5].pos.x = b.x - d1_x; vtx_write[5].pos.y = b.y - d1_y; vtx_write[5].uv = opaque_uv; vtx_write[5].col = col_trans;
+                    idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+                    idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+                    idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0);
+                    idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                }
+                else
+                {
+                    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+                    const float d0_out_x = n_x * half_outer_thickness, d0_out_y = n_y * half_outer_thickness;
+                    const float d0_in_x = n_x * half_inner_thickness, d0_in_y = n_y * half_inner_thickness;
+                    const float d1_out_x = dm_x * half_outer_thickness, d1_out_y = dm_y * half_outer_thickness;
+                    const float d1_in_x = dm_x * half_inner_thickness, d1_in_y = dm_y * half_inner_thickness;
+                    vtx_write[0].pos.x = a.x + d0_out_x; vtx_write[0].pos.y = a.y + d0_out_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+                    vtx_write[1].pos.x = a.x + d0_in_x;  vtx_write[1].pos.y = a.y + d0_in_y;  vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                    vtx_write[2].pos.x = a.x - d0_in_x;  vtx_write[2].pos.y = a.y - d0_in_y;  vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                    vtx_write[3].pos.x = a.x - d0_out_x; vtx_write[3].pos.y = a.y - d0_out_y; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+                    vtx_write[4].pos.x = b.x + d1_out_x; vtx_write[4].pos.y = b.y + d1_out_y; vtx_write[4].uv = opaque_uv; vtx_write[4].col = col_trans;
+                    vtx_write[5].pos.x = b.x + d1_in_x;  vtx_write[5].pos.y = b.y + d1_in_y;  vtx_write[5].uv = opaque_uv; vtx_write[5].col = col;
+                    vtx_write[6].pos.x = b.x - d1_in_x;  vtx_write[6].pos.y = b.y - d1_in_y;  vtx_write[6].uv = opaque_uv; vtx_write[6].col = col;
+                    vtx_write[7].pos.x = b.x - d1_out_x; vtx_write[7].pos.y = b.y - d1_out_y; vtx_write[7].uv = opaque_uv; vtx_write[7].col = col_trans;
+                    idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+                    idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+                    idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+                    idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                    idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+                    idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+                }
+            }
+            vtx_write += vtx_per_line;
+            idx_write += idx_per_line;
+            idx += vtx_per_line;
+        }
+        PrimUnreserve(chunk_count * idx_per_line - (int)(idx_write - _IdxWritePtr), chunk_count * vtx_per_line - (int)(vtx_write - _VtxWritePtr));
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        chunk_start = chunk_end;
+    }
+}
+
 void ImDrawList::AddText(ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1734,8 +2358,15 @@ void ImDrawList::AddImage(ImTextureRef tex_ref, const ImVec2& p_min, const ImVec
     if (push_texture_id)
         PushTexture(tex_ref);
 
-    PrimReserve(6, 4);
-    PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    if (ImDrawList_UseRectInstances(this, 1))
+    {
+        PrimRectInstance(p_min, p_max, uv_min, uv_max, col);
+    }
+    else
+    {
+        PrimReserve(6, 4);
+        PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    }
 
     if (push_texture_id)
         PopTexture();
@@ -1794,6 +2425,74 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 // - AddConcavePolyFilled()
 //-----------------------------------------------------------------------------
 
+// Classify a polygon in a single pass: return true if it is convex, and output its winding order.
+// - Convex: all turns are in the same direction, and the polygon winds only once. The latter is checked by counting
+//   sign changes of edges directions on each axis, which can't exceed 2 for a convex polygon (this rejects e.g. pentagrams).
+// - Clockwise: using the sign of the polygon area, consistently with ImTriangleIsClockwise(). Degenerate polygons report clockwise.
+static bool ImPolygonClassify(const ImVec2* points, int points_count, bool* out_clockwise)
+{
+    bool convex = true;
+    float area = 0.0f; // Twice the signed area
+    float turn = 0.0f;
+    int i0 = points_count - 1; // Skip points duplicating the first one, we need the last non-zero edge to get the turn direction at first point
+    while (i0 > 1 && points[i0].x == points[0].x && points[i0].y == points[0].y)
+        i0--;
+    float e0_x = points[0].x - points[i0].x;
+    float e0_y = points[0].y - points[i0].y;
+    int first_sign_x = 0, first_sign_y = 0, last_sign_x = 0, last_sign_y = 0;
+    int sign_changes_x = 0, sign_changes_y = 0;
+    for (int i1 = 0; i1 < points_count; i1++)
+    {
+        const ImVec2& p1 = points[i1];
+        const ImVec2& p2 = points[(i1 + 1 == points_count) ? 0 : i1 + 1];
+        area += p1.x * p2.y - p2.x * p1.y;
+        if (!convex)
+            continue;
+
+        // Turn direction
+        const float e1_x = p2.x - p1.x;
+        const float e1_y = p2.y - p1.y;
+        if (e1_x == 0.0f && e1_y == 0.0f)
+            continue;
+        const float cross = e0_x * e1_y - e0_y * e1_x;
+        if (cross != 0.0f)
+        {
+            if (turn == 0.0f)
+                turn = cross;
+            else if ((cross > 0.0f) != (turn > 0.0f))
+                convex = false;
+        }
+
+        // Edges direction sign changes
+        if (e1_x != 0.0f)
+        {
+            const int sign = (e1_x > 0.0f) ? +1 : -1;
+            if (first_sign_x == 0)
+                first_sign_x = sign;
+            else if (sign != last_sign_x)
+                sign_changes_x++;
+            last_sign_x = sign;
+        }
+        if (e1_y != 0.0f)
+        {
+            const int sign = (e1_y > 0.0f) ? +1 : -1;
+            if (first_sign_y == 0)
+                first_sign_y = sign;
+            else if (sign != last_sign_y)
+                sign_changes_y++;
+            last_sign_y = sign;
+        }
+        e0_x = e1_x;
+        e0_y = e1_y;
+    }
+    if (last_sign_x != first_sign_x)
+        sign_changes_x++;
+    if (last_sign_y != first_sign_y)
+        sign_changes_y++;
+    *out_clockwise = (area >= 0.0f);
+    return convex && sign_changes_x <= 2 && sign_changes_y <= 2;
+}
+
 enum ImTriangulatorNodeType
 {
     ImTriangulatorNodeType_Convex,
@@ -1826,7 +2525,7 @@ struct ImTriangulator
     static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
     static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
 
-    void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
+    void    Init(const ImVec2* points, int points_count, void* scratch_buffer, bool clockwise = true);
     void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
 
     // Internal functions
@@ -1845,9 +2544,9 @@ struct ImTriangulator
 };
 
 // Distribute storage for nodes, ears and reflexes.
-// FIXME-OPT: if everything is convex, we could report it to caller and let it switch to an convex renderer
-// (this would require first building reflexes to bail to convex if empty, without even building nodes)
-void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
+// Convex polygons are expected to be detected by caller with ImPolygonClassify() and use a convex renderer.
+// Counter-clockwise polygons are flipped upfront, as the ear/reflex classification assumes clockwise winding.
+void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer, bool clockwise)
 {
     IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
     _TrianglesLeft = EstimateTriangleCount(points_count);
@@ -1855,6 +2554,8 @@ void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_
     _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
     _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
     BuildNodes(points, points_count);
+    if (!clockwise)
+        FlipNodeList();
     BuildReflexes();
     BuildEars();
 }
@@ -2009,6 +2710,14 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
 
+    // Convex polygons can use the faster convex renderer
+    bool clockwise;
+    if (ImPolygonClassify(points, points_count, &clockwise))
+    {
+        AddConvexPolyFilled(points, points_count, col);
+        return;
+    }
+
     const ImVec2 uv = _Data->TexUvWhitePixel;
     ImTriangulator triangulator;
     unsigned int triangle[3];
@@ -2026,7 +2735,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
 
         _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        triangulator.Init(points, points_count, _Data->TempBuffer.Data, clockwise);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2083,7 +2792,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr++;
         }
         _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        triangulator.Init(points, points_count, _Data->TempBuffer.Data, clockwise);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2105,9 +2814,10 @@ void ImDrawListSplitter::ClearFreeMemory()
     for (int i = 0; i < _Channels.Size; i++)
     {
         if (i == _Current)
-            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
+            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer/RectBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
+        _Channels[i]._RectBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
@@ -2126,7 +2836,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
     _Count = channels_count;
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // Channels[] (36/48 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer/_RectBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
     // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
     memset(&_Channels[0], 0, sizeof(ImDrawChannel));
@@ -2140,6 +2850,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
+            _Channels[i]._RectBuffer.resize(0);
         }
     }
 }
@@ -2153,52 +2864,59 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes (the command count is an upper bound, as commands may be merged across channels)
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    int new_rect_buffer_count = 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().RectCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
+        new_rect_buffer_count += ch._RectBuffer.Size;
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int old_cmd_buffer_count = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(old_cmd_buffer_count + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    draw_list->RectBuffer.resize(draw_list->RectBuffer.Size + new_rect_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Write commands, indices and rect instances directly at their final offset, in a single pass (we don't copy vertices only indices).
+    // Commands get their final IdxOffset/RectOffset values, and the first command of each channel is merged into the previous one if matching.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + old_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawRectInstance* rect_write = draw_list->RectBuffer.Data + draw_list->RectBuffer.Size - new_rect_buffer_count;
+    ImDrawCmd* last_cmd = (old_cmd_buffer_count > 0) ? cmd_write - 1 : NULL;
+    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    int rect_offset = draw_list->RectBuffer.Size - new_rect_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        {
+            ImDrawCmd* src_cmd = &ch._CmdBuffer.Data[cmd_n];
+            src_cmd->IdxOffset = idx_offset;
+            src_cmd->RectOffset = rect_offset;
+            idx_offset += src_cmd->ElemCount;
+            rect_offset += src_cmd->RectCount;
+
+            // Merge previous channel last draw command with current channel first draw command if matching.
+            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+            if (cmd_n == 0 && last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, src_cmd) == 0 && ImDrawCmd_AreCompatibleKinds(last_cmd, src_cmd) && last_cmd->UserCallback == NULL && src_cmd->UserCallback == NULL)
+            {
+                last_cmd->ElemCount += src_cmd->ElemCount;
+                ImDrawCmd_MergeRects(last_cmd, src_cmd);
+                continue;
+            }
+            memcpy(cmd_write, src_cmd, sizeof(ImDrawCmd));
+            last_cmd = cmd_write++;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._RectBuffer.Size) { memcpy(rect_write, ch._RectBuffer.Data, sz * sizeof(ImDrawRectInstance)); rect_write += sz; }
     }
+    draw_list->CmdBuffer.Size = (int)(cmd_write - draw_list->CmdBuffer.Data); // Trim merged commands
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -2207,7 +2925,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2224,16 +2942,18 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Current]._RectBuffer, &draw_list->RectBuffer, sizeof(draw_list->RectBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->RectBuffer, &_Channels.Data[idx]._RectBuffer, sizeof(draw_list->RectBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
+    else if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2246,11 +2966,12 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::Clear()
 {
     Valid = false;
-    CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    CmdListsCount = TotalIdxCount = TotalVtxCount = TotalRectCount = 0;
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
     Textures = NULL;
+    Fingerprint = 0;
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2259,7 +2980,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].RectCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
@@ -2298,6 +3019,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
     draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalRectCount += draw_list->RectBuffer.Size;
 }
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
@@ -2307,6 +3029,228 @@ void ImDrawData::AddDrawList(ImDrawList* draw_list)
     ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
 }
 
+// Fast non-cryptographic 64-bit hash for bulk data, used to fingerprint draw data.
+// ImHashData() is a byte-wise CRC32 which would be too slow for vertex buffers. We mix four 64-bit lanes in parallel.
+static inline ImU64 ImDrawData_HashMix64(ImU64 h) { h ^= h >> 33; h *= 0xFF51AFD7ED558CCDULL; h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53ULL; h ^= h >> 33; return h; }
+static ImU64 ImDrawData_HashBuffer(const void* data, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU64 h[4] = { seed ^ (ImU64)data_size, seed + k, seed + k * 2, seed + k * 3 };
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+    for (; p + 32 <= p_end; p += 32)
+    {
+        ImU64 w[4];
+        memcpy(w, p, 32);
+        for (int n = 0; n < 4; n++)
+        {
+            h[n] = (h[n] ^ w[n]) * k;
+            h[n] = (h[n] << 31) | (h[n] >> 33);
+        }
+    }
+    if (p < p_end)
+    {
+        ImU64 w[4] = { 0, 0, 0, 0 };
+        memcpy(w, p, (size_t)(p_end - p));
+        for (int n = 0; n < 4; n++)
+            h[n] = (h[n] ^ w[n]) * k;
+    }
+    return ImDrawData_HashMix64(ImDrawData_HashMix64(ImDrawData_HashMix64(ImDrawData_HashMix64(h[0]) ^ h[1]) ^ h[2]) ^ h[3]);
+}
+
+// Calculate a fingerprint of draw data contents: draw commands (including texture references and clip rectangles), indices, vertices, rect instances and display rectangle.
+// - Fingerprint of each draw list is stored in ImDrawList::_Fingerprint and reused until the draw list is reset: draw lists reused from
+//   previous frame (e.g. windows using ImGuiWindowRefreshFlags_TryToAvoidRefresh) are not hashed again.
+// - Texture contents are not hashed: the caller should also check for pending texture updates.
+// - Return 0 when there are user callbacks, as we can't know what they are rendering.
+ImU64 ImGui::CalcDrawDataFingerprint(ImDrawData* draw_data)
+{
+    const ImVec2 display_state[3] = { draw_data->DisplayPos, draw_data->DisplaySize, draw_data->FramebufferScale };
+    ImU64 hash = ImDrawData_HashBuffer(display_state, sizeof(display_state), (ImU64)draw_data->CmdLists.Size);
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        if (draw_list->_Fingerprint == 0)
+        {
+            for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+                if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                    return 0;
+
+            // ImDrawCmd padding is always zero-cleared so we can hash the whole buffer.
+            ImU64 list_hash = ImDrawData_HashBuffer(draw_list->CmdBuffer.Data, (size_t)draw_list->CmdBuffer.size_in_bytes(), 0);
+            list_hash = ImDrawData_HashBuffer(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), list_hash);
+            list_hash = ImDrawData_HashBuffer(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), list_hash);
+            list_hash = ImDrawData_HashBuffer(draw_list->RectBuffer.Data, (size_t)draw_list->RectBuffer.size_in_bytes(), list_hash);
+            draw_list->_Fingerprint = list_hash ? list_hash : 1;
+        }
+        hash = ImDrawData_HashMix64(hash ^ draw_list->_Fingerprint) + 0x9E3779B97F4A7C15ULL; // Order dependent
+    }
+    return hash ? hash : 1;
+}
+
+// Return true if all vertices of a draw command are within its clip rectangle, with a 1 pixel margin.
+// Merging such commands into a command using a larger clip rectangle doesn't change rasterized pixels.
+static bool ImDrawCmd_IsContainedInClipRect(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    const float min_x = cmd->ClipRect.x + 1.0f, min_y = cmd->ClipRect.y + 1.0f, max_x = cmd->ClipRect.z - 1.0f, max_y = cmd->ClipRect.w - 1.0f;
+    if (cmd->RectCount > 0)
+    {
+        for (const ImDrawRectInstance* rect = draw_list->RectBuffer.Data + cmd->RectOffset, *rect_end = rect + cmd->RectCount; rect < rect_end; rect++)
+            if (ImMin(rect->PosMin.x, rect->PosMax.x) < min_x || ImMin(rect->PosMin.y, rect->PosMax.y) < min_y || ImMax(rect->PosMin.x, rect->PosMax.x) > max_x || ImMax(rect->PosMin.y, rect->PosMax.y) > max_y)
+                return false;
+        return true;
+    }
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    for (const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd->IdxOffset, *idx_end = idx + cmd->ElemCount; idx < idx_end; idx++)
+    {
+        const ImVec2 pos = vtx_buffer[*idx].pos;
+        if (pos.x < min_x || pos.y < min_y || pos.x > max_x || pos.y > max_y)
+            return false;
+    }
+    return true;
+}
+
+// Try to append 'cmd' to 'prev_cmd', the last command of 'draw_list'.
+// Commands with a different ClipRect may be merged using the union of both clip rectangles, if both are contained in their own clip rectangle.
+// 'prev_contained'/'cmd_contained' cache the result of ImDrawCmd_IsContainedInClipRect() (-1: unknown) as it requires scanning vertices.
+static bool ImDrawCmd_TryMergeAcrossDrawLists(const ImDrawList* draw_list, ImDrawCmd* prev_cmd, const ImDrawCmd* cmd, int* prev_contained, int* cmd_contained)
+{
+    *cmd_contained = -1;
+    if (prev_cmd->UserCallback != NULL || cmd->UserCallback != NULL)
+        return false;
+    if (memcmp(&prev_cmd->TexRef, &cmd->TexRef, ImDrawCmd_HeaderSize - offsetof(ImDrawCmd, TexRef)) != 0) // Compare TexRef, VtxOffset
+        return false;
+    if (!ImDrawCmd_AreSequentialIdxOffset(prev_cmd, cmd) || !ImDrawCmd_AreCompatibleKinds(prev_cmd, cmd))
+        return false;
+    if (memcmp(&prev_cmd->ClipRect, &cmd->ClipRect, sizeof(ImVec4)) != 0)
+    {
+        if (*prev_contained < 0)
+            *prev_contained = ImDrawCmd_IsContainedInClipRect(draw_list, prev_cmd) ? 1 : 0;
+        if (*prev_contained == 0)
+            return false;
+        *cmd_contained = ImDrawCmd_IsContainedInClipRect(draw_list, cmd) ? 1 : 0;
+        if (*cmd_contained == 0)
+            return false;
+        prev_cmd->ClipRect = ImVec4(ImMin(prev_cmd->ClipRect.x, cmd->ClipRect.x), ImMin(prev_cmd->ClipRect.y, cmd->ClipRect.y), ImMax(prev_cmd->ClipRect.z, cmd->ClipRect.z), ImMax(prev_cmd->ClipRect.w, cmd->ClipRect.w));
+    }
+    else if (*prev_contained == 1)
+    {
+        *prev_contained = ImDrawCmd_IsContainedInClipRect(draw_list, cmd) ? 1 : 0; // Scan incrementally: each index is scanned at most once
+    }
+    prev_cmd->ElemCount += cmd->ElemCount;
+    ImDrawCmd_MergeRects(prev_cmd, cmd);
+    return true;
+}
+
+// Concatenate draw lists of 'draw_data' into fewer draw lists taken from 'merged_draw_lists' pool, merging draw commands when possible.
+// - Used by Render() when io.ConfigDrawDataMergeDrawLists is set. Output draw lists only have their buffers filled (they are not meant to be drawn into).
+// - With 16-bit indices, we start a new VtxOffset segment (ImGuiBackendFlags_RendererHasVtxOffset) or a new draw list when a segment would exceed 64K vertices.
+//   Indices are rebased relative to the start of their segment, so commands of consecutive windows can be merged.
+// - Draw lists with user callbacks are passed through as-is: callbacks are given their parent draw list and may rely on it.
+void ImGui::MergeDrawListsInDrawData(ImDrawData* draw_data, ImVector<ImDrawList*>* merged_draw_lists)
+{
+    ImGuiContext& g = *GImGui;
+    if (draw_data->CmdLists.Size <= 1)
+        return;
+    const bool allow_vtx_offset = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) != 0;
+    const unsigned int max_vtx_per_segment = (sizeof(ImDrawIdx) == 2) ? (1 << 16) : 0xFFFFFFFF;
+
+    // Output lists are written in place in CmdLists[], as we never output more lists than we consume.
+    ImVector<ImDrawList*>& cmd_lists = draw_data->CmdLists;
+    ImDrawList* out_list = NULL;
+    unsigned int segment_vtx_offset = 0;
+    int merged_lists_count = 0;
+    int write_n = 0;
+    int prev_contained = -1;
+    for (int read_n = 0; read_n < cmd_lists.Size; read_n++)
+    {
+        ImDrawList* src_list = cmd_lists[read_n];
+        bool src_uses_vtx_offset = false;
+        bool src_has_user_callbacks = false;
+        for (const ImDrawCmd& cmd : src_list->CmdBuffer)
+        {
+            src_uses_vtx_offset |= (cmd.VtxOffset != 0);
+            src_has_user_callbacks |= (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState);
+        }
+        if (src_has_user_callbacks)
+        {
+            cmd_lists[write_n++] = src_list;
+            out_list = NULL;
+            continue;
+        }
+
+        // Start a new segment or a new output draw list when indices would overflow
+        const unsigned int src_vtx_count = (unsigned int)src_list->VtxBuffer.Size;
+        if (out_list != NULL && (src_uses_vtx_offset || (unsigned int)out_list->VtxBuffer.Size - segment_vtx_offset + src_vtx_count > max_vtx_per_segment))
+        {
+            if (allow_vtx_offset)
+                segment_vtx_offset = (unsigned int)out_list->VtxBuffer.Size;
+            else
+                out_list = NULL;
+        }
+        if (out_list == NULL)
+        {
+            if (merged_lists_count == merged_draw_lists->Size)
+            {
+                ImDrawList* new_list = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+                new_list->_OwnerName = "##MergedDrawList";
+                merged_draw_lists->push_back(new_list);
+            }
+            out_list = (*merged_draw_lists)[merged_lists_count++];
+            out_list->CmdBuffer.resize(0);
+            out_list->IdxBuffer.resize(0);
+            out_list->VtxBuffer.resize(0);
+            out_list->RectBuffer.resize(0);
+            segment_vtx_offset = 0;
+            prev_contained = -1;
+            cmd_lists[write_n++] = out_list;
+        }
+
+        // Append vertices, indices and rect instances
+        const int vtx_base = out_list->VtxBuffer.Size;
+        const int idx_base = out_list->IdxBuffer.Size;
+        const int rect_base = out_list->RectBuffer.Size;
+        out_list->VtxBuffer.resize(vtx_base + src_list->VtxBuffer.Size);
+        out_list->IdxBuffer.resize(idx_base + src_list->IdxBuffer.Size);
+        out_list->RectBuffer.resize(rect_base + src_list->RectBuffer.Size);
+        if (src_list->VtxBuffer.Size > 0)
+            memcpy(out_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        if (src_list->RectBuffer.Size > 0)
+            memcpy(out_list->RectBuffer.Data + rect_base, src_list->RectBuffer.Data, src_list->RectBuffer.Size * sizeof(ImDrawRectInstance));
+        const unsigned int idx_rebase = src_uses_vtx_offset ? 0 : (unsigned int)vtx_base - segment_vtx_offset;
+        if (idx_rebase == 0)
+        {
+            if (src_list->IdxBuffer.Size > 0)
+                memcpy(out_list->IdxBuffer.Data + idx_base, src_list->IdxBuffer.Data, src_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        }
+        else
+        {
+            ImDrawIdx* idx_write = out_list->IdxBuffer.Data + idx_base;
+            for (const ImDrawIdx* idx_read = src_list->IdxBuffer.Data, *idx_end = idx_read + src_list->IdxBuffer.Size; idx_read < idx_end; idx_read++)
+                *idx_write++ = (ImDrawIdx)(*idx_read + idx_rebase);
+        }
+
+        // Append commands, merging them with the previous command when possible
+        for (const ImDrawCmd& src_cmd : src_list->CmdBuffer)
+        {
+            if (src_cmd.ElemCount == 0 && src_cmd.RectCount == 0 && src_cmd.UserCallback == NULL)
+                continue;
+            ImDrawCmd cmd = src_cmd;
+            cmd.IdxOffset += idx_base;
+            cmd.RectOffset += rect_base;
+            cmd.VtxOffset = src_uses_vtx_offset ? vtx_base + src_cmd.VtxOffset : segment_vtx_offset;
+            int cmd_contained = -1;
+            if (out_list->CmdBuffer.Size > 0 && ImDrawCmd_TryMergeAcrossDrawLists(out_list, &out_list->CmdBuffer.back(), &cmd, &prev_contained, &cmd_contained))
+                continue;
+            out_list->CmdBuffer.push_back(cmd);
+            prev_contained = cmd_contained;
+        }
+        if (src_uses_vtx_offset)
+            segment_vtx_offset = (unsigned int)out_list->VtxBuffer.Size; // Following draw lists can't share the segment of a large draw list
+    }
+    cmd_lists.resize(write_n);
+    draw_data->CmdListsCount = write_n;
+}
+
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
 void ImDrawData::DeIndexAllBuffers()
 {
@@ -2335,6 +3279,15 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+void ImDrawDataSnapshot::Clear()
+{
+    for (ImDrawList* draw_list : DrawListsPool)
+        IM_DELETE(draw_list);
+    DrawListsPool.clear();
+    Textures.clear();
+    DrawData.Clear();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -2540,6 +3493,9 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasRemoveDrawListSharedData()
 // - ImFontAtlasUpdateDrawListsTextures()
 // - ImFontAtlasUpdateDrawListsSharedData()
+// - ImFontAtlasLockContextShared()
+// - ImFontAtlasLockForWrite()
+// - ImFontAtlasUnlockForWrite()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasBuildSetTexture()
 // - ImFontAtlasBuildAddTexture()
@@ -2561,6 +3517,7 @@ void ImTextureData::DestroyPixels()
 //-----------------------------------------------------------------------------
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
+// - ImFontBaked_BuildLoadGlyphLocked()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
@@ -2731,6 +3688,7 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
+    IMGUI_PROFILER_ZONE("ImFontAtlasUpdateNewFrame");
     atlas->RendererHasTextures = renderer_has_textures;
 
     // Check that font atlas was built or backend support texture reload in which case we can build now
@@ -3930,6 +4888,48 @@ void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
         }
 }
 
+// [Multi-threading] Atlas shared by contexts updated from multiple threads, see ImFontAtlas::LockFunc.
+// - A context holds a shared lock on its atlases during NewFrame()..EndFrame() and Render(), where it mostly reads from them.
+// - Modifying an atlas (loading a glyph, baking a new size) trades all shared locks held by the current context for an exclusive lock.
+//   Releasing all of them avoids dead-locking with another thread waiting for an exclusive lock on one of them.
+// - Other threads may modify the atlas during ImFontAtlasLockForWrite(): anything read from it before the call (e.g. ImFontGlyph* pointers,
+//   ImVector<> storage) needs to be read again after it. ImFontBaked* pointers stay valid, they are only recycled by ImFontAtlasUpdateNewFrame().
+void ImFontAtlasLockContextShared(ImGuiContext* ctx, bool lock)
+{
+    if (ctx->FontAtlasesLockShared == lock)
+        return;
+    ctx->FontAtlasesLockShared = lock;
+    for (ImFontAtlas* atlas : ctx->FontAtlases)
+        if (atlas->LockFunc != NULL)
+            atlas->LockFunc(atlas, lock ? ImFontAtlasLockOp_LockShared : ImFontAtlasLockOp_UnlockShared);
+}
+
+void ImFontAtlasLockForWrite(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->LockFunc != NULL);
+    ImGuiContext& g = *GImGui; // Each thread needs its own current context (see IMGUI_USE_THREAD_LOCAL_CONTEXT)
+    if (g.FontAtlasesLockWriteDepth++ > 0)
+        return;
+    if (g.FontAtlasesLockShared)
+        for (ImFontAtlas* held_atlas : g.FontAtlases)
+            if (held_atlas->LockFunc != NULL)
+                held_atlas->LockFunc(held_atlas, ImFontAtlasLockOp_UnlockShared);
+    atlas->LockFunc(atlas, ImFontAtlasLockOp_LockExclusive);
+}
+
+void ImFontAtlasUnlockForWrite(ImFontAtlas* atlas)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.FontAtlasesLockWriteDepth > 0);
+    if (--g.FontAtlasesLockWriteDepth > 0)
+        return;
+    atlas->LockFunc(atlas, ImFontAtlasLockOp_UnlockExclusive);
+    if (g.FontAtlasesLockShared)
+        for (ImFontAtlas* held_atlas : g.FontAtlases)
+            if (held_atlas->LockFunc != NULL)
+                held_atlas->LockFunc(held_atlas, ImFontAtlasLockOp_LockShared);
+}
+
 // Set current texture. This is mostly called from AddTexture() + to handle a failed resize.
 static void ImFontAtlasBuildSetTexture(ImFontAtlas* atlas, ImTextureData* tex)
 {
@@ -3993,6 +4993,8 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
+    IMGUI_PROFILER_ZONE("ImFontAtlasTextureRepack");
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_TextureRepack);
     ImFontAtlasBuilder* builder = atlas->Builder;
     builder->LockDisableResize = true;
 
@@ -4066,6 +5068,8 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
+    IMGUI_PROFILER_ZONE("ImFontAtlasTextureGrow");
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_TextureGrow);
     ImFontAtlasBuilder* builder = atlas->Builder;
     if (old_tex_w == -1)
         old_tex_w = atlas->TexData->Width;
@@ -4412,6 +5416,8 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
 
 static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
+    IMGUI_PROFILER_ZONE("ImFontBaked_BuildLoadGlyph");
+    IMGUI_DEBUG_HITCH_EVENT(ImGuiDebugHitchEventType_GlyphLoad);
     ImFont* font = baked->ContainerFont;
     ImFontAtlas* atlas = font->ContainerAtlas;
     if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
@@ -4481,18 +5487,49 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
     return NULL;
 }
 
+// [Multi-threading] Atlas shared by contexts updated from multiple threads (see ImFontAtlas::LockFunc and ImFontAtlasLockForWrite())
+// - Trade our shared lock for an exclusive one, then check again as another thread may have loaded this glyph in the meantime.
+// - Once back to a shared lock, other threads may have grown baked->Glyphs[], so we return a pointer looked up again from the index.
+static ImFontGlyph* ImFontBaked_BuildLoadGlyphLocked(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, bool no_fallback)
+{
+    ImFontAtlas* atlas = baked->ContainerFont->ContainerAtlas;
+    ImFontAtlasLockForWrite(atlas);
+    ImFontGlyph* glyph = NULL;
+    const int glyph_idx_prev = (codepoint < (size_t)baked->IndexLookup.Size) ? (int)baked->IndexLookup.Data[codepoint] : IM_FONTGLYPH_INDEX_UNUSED;
+    if (glyph_idx_prev == IM_FONTGLYPH_INDEX_UNUSED)
+    {
+        if (no_fallback)
+            baked->LockLoadingFallback = true;
+        glyph = ImFontBaked_BuildLoadGlyph(baked, codepoint, only_load_advance_x);
+        if (no_fallback)
+            baked->LockLoadingFallback = false;
+    }
+    else if (glyph_idx_prev != IM_FONTGLYPH_INDEX_NOT_FOUND)
+    {
+        glyph = &baked->Glyphs.Data[glyph_idx_prev];
+    }
+    else if (only_load_advance_x != NULL)
+    {
+        *only_load_advance_x = baked->FallbackAdvanceX;
+    }
+    const int glyph_idx = glyph ? (int)(glyph - baked->Glyphs.Data) : -1;
+    ImFontAtlasUnlockForWrite(atlas);
+    return (glyph_idx != -1) ? &baked->Glyphs.Data[glyph_idx] : NULL;
+}
+
 static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
 {
+    const bool use_lock = (baked->ContainerFont->ContainerAtlas->LockFunc != NULL);
     if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE)
     {
         // First load AdvanceX value used by CalcTextSize() API then load the rest when loaded by drawing API.
         float only_advance_x = 0.0f;
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
+        ImFontGlyph* glyph = use_lock ? ImFontBaked_BuildLoadGlyphLocked(baked, codepoint, &only_advance_x, false) : ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
         return glyph ? glyph->AdvanceX : only_advance_x;
     }
     else
     {
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
+        ImFontGlyph* glyph = use_lock ? ImFontBaked_BuildLoadGlyphLocked(baked, codepoint, NULL, false) : ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
         return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
     }
 }
@@ -5207,7 +6244,7 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
             return &Glyphs.Data[i];
     }
-    ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
+    ImFontGlyph* glyph = ContainerFont->ContainerAtlas->LockFunc ? ImFontBaked_BuildLoadGlyphLocked(this, c, NULL, false) : ImFontBaked_BuildLoadGlyph(this, c, NULL);
     return glyph ? glyph : &Glyphs.Data[FallbackGlyphIndex];
 }
 
@@ -5222,6 +6259,8 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
             return &Glyphs.Data[i];
     }
+    if (ContainerFont->ContainerAtlas->LockFunc)
+        return ImFontBaked_BuildLoadGlyphLocked(this, c, NULL, true);
     LockLoadingFallback = true; // This is actually a rare call, not done in hot-loop, so we prioritize not adding extra cruft to ImFontBaked_BuildLoadGlyph() call sites.
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     LockLoadingFallback = false;
@@ -5279,21 +6318,51 @@ ImGuiID ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterize
     return ImHashData(&hashed_data, sizeof(hashed_data));
 }
 
+// [Multi-threading] Atlas shared by contexts updated from multiple threads (see ImFontAtlas::LockFunc and ImFontAtlasLockForWrite())
+// - Don't use the ImFont::LastBaked cache which would be written to by all threads.
+// - Only trade our shared lock for an exclusive one when a new size needs to be baked.
+static ImFontBaked* ImFontAtlasBakedGetOrAddLocked(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density));
+    if (baked == NULL && (font->Flags & ImFontFlags_LockBakedSizes) == 0 && !atlas->Locked)
+    {
+        ImFontAtlasLockForWrite(atlas);
+        baked = ImFontAtlasBakedGetOrAdd(atlas, font, font_size, font_rasterizer_density);
+        if (baked != NULL)
+            baked->LastUsedFrame = builder->FrameCount;
+        ImFontAtlasUnlockForWrite(atlas);
+        return baked;
+    }
+    if (baked == NULL)
+        baked = ImFontAtlasBakedGetOrAdd(atlas, font, font_size, font_rasterizer_density); // Find closest match, doesn't modify atlas.
+    if (baked != NULL && baked->LastUsedFrame != builder->FrameCount)
+    {
+        // Only written under an exclusive lock (once per baked size per atlas frame), as other threads read it under their shared lock.
+        ImFontAtlasLockForWrite(atlas);
+        baked->LastUsedFrame = builder->FrameCount;
+        ImFontAtlasUnlockForWrite(atlas);
+    }
+    return baked;
+}
+
 // ImFontBaked pointers are valid for the entire frame but shall never be kept between frames.
 ImFontBaked* ImFont::GetFontBaked(float size, float density)
 {
-    ImFontBaked* baked = LastBaked;
-
     // Round font size
     // - ImGui::PushFont() will already round, but other paths calling GetFontBaked() directly also needs it (e.g. ImFontAtlasBuildPreloadAllGlyphRanges)
     size = ImGui::GetRoundedFontSize(size);
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
+    ImFontAtlas* atlas = ContainerAtlas;
+    if (atlas->LockFunc != NULL)
+        return ImFontAtlasBakedGetOrAddLocked(atlas, this, size, density);
+
+    ImFontBaked* baked = LastBaked;
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
-    ImFontAtlas* atlas = ContainerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
@@ -5576,6 +6645,11 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    if (ImDrawList_UseRectInstances(draw_list, 1))
+    {
+        draw_list->PrimRectInstance(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+        return;
+    }
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
 }
@@ -5583,12 +6657,15 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
+    IMGUI_PROFILER_ZONE("RenderText");
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
     if (y > clip_rect.w)
         return;
+    if (x - size > clip_rect.z) // Every line starts at 'x': leave a margin for glyphs with negative X0 (e.g. italic overhang)
+        return;
 
     if (!text_end)
         text_end = text_begin + ImStrlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
@@ -5601,7 +6678,14 @@ begin:
     const bool word_wrap_enabled = (wrap_width > 0.0f);
 
     // Fast-forward to first visible line
+    // Without word-wrapping every line has the same height, so we can compute the number of lines to skip and jump straight to it.
     const char* s = text_begin;
+    if (y + line_height < clip_rect.y && !word_wrap_enabled)
+    {
+        int lines_skipped = 0;
+        s = ImTextSkipLines(s, text_end, ImMax((int)ImCeil((clip_rect.y - y) / line_height) - 1, 0), &lines_skipped);
+        y += lines_skipped * line_height;
+    }
     if (y + line_height < clip_rect.y)
         while (y + line_height < clip_rect.y && s < text_end)
         {
@@ -5624,25 +6708,22 @@ begin:
     // For large text, scan for the last visible line in order to avoid over-reserving in the call to PrimReserve()
     // Note that very large horizontal line will still be affected by the issue (e.g. a one megabyte string buffer without a newline will likely crash atm)
     if (text_end - s > 10000 && !word_wrap_enabled)
-    {
-        const char* s_end = s;
-        float y_end = y;
-        while (y_end < clip_rect.w && s_end < text_end)
-        {
-            s_end = (const char*)ImMemchr(s_end, '\n', text_end - s_end);
-            s_end = s_end ? s_end + 1 : text_end;
-            y_end += line_height;
-        }
-        text_end = s_end;
-    }
+        text_end = ImTextSkipLines(s, text_end, ImMax((int)ImCeil((clip_rect.w - y) / line_height), 0));
     if (s == text_end)
         return;
 
-    // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
+    // Reserve vertices (or rect instances) for remaining worse case (over-reserving is useful and easily amortized)
+    const bool use_rects = ImDrawList_UseRectInstances(draw_list, (int)(text_end - s));
+    const int vtx_count_max = use_rects ? 0 : (int)(text_end - s) * 4;
+    const int idx_count_max = use_rects ? 0 : (int)(text_end - s) * 6;
+    const int rect_count_max = use_rects ? (int)(text_end - s) : 0;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawRectInstance* rect_write = NULL;
+    if (use_rects)
+        rect_write = draw_list->PrimReserveRects(rect_count_max);
+    else
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawRectInstance* rect_write_start = rect_write;
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
@@ -5746,6 +6827,14 @@ begin:
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                if (rect_write)
+                {
+                    rect_write->PosMin.x = x1; rect_write->PosMin.y = y1; rect_write->PosMax.x = x2; rect_write->PosMax.y = y2;
+                    rect_write->UvMin.x = u1; rect_write->UvMin.y = v1; rect_write->UvMax.x = u2; rect_write->UvMax.y = v2;
+                    rect_write->Col = glyph_col;
+                    rect_write++;
+                }
+                else
                 {
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
@@ -5765,9 +6854,12 @@ begin:
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
     {
-        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
+        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0 && draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].RectCount == 0);
         draw_list->CmdBuffer.pop_back();
-        draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
+        if (use_rects)
+            draw_list->PrimUnreserveRects(rect_count_max);
+        else
+            draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
@@ -5777,6 +6869,11 @@ begin:
     }
 
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    if (use_rects)
+    {
+        draw_list->PrimUnreserveRects(rect_count_max - (int)(rect_write - rect_write_start));
+        return;
+    }
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
@@ -135,6 +135,7 @@ Index of this file:
 // Utilities
 // (other types which are not forwarded declared are: ImBitArray<>, ImSpan<>, ImSpanAllocator<>, ImStableVector<>, ImPool<>, ImChunkStream<>)
 struct ImBitVector;                 // Store 1-bit per value
+struct ImLinearAllocator;           // Bump pointer allocator for transient data
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 
@@ -184,6 +185,8 @@ struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHibernateData;    // Storage for the state of a window destroyed by GcHibernateWindowList(), restored on its next Begin()
+struct ImGuiWindowHitGrid;          // Uniform grid of hit-testable windows, to accelerate finding windows under a given position
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -220,8 +223,12 @@ typedef ImU16 ImGuiTableDrawChannelIdx;
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui; // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -347,6 +354,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helpers: String
 // - Helpers: Formatting
 // - Helpers: UTF-8 <> wchar conversions
+// - Helpers: Time
 // - Helpers: ImVec2/ImVec4 operators
 // - Helpers: Maths
 // - Helpers: Geometry
@@ -426,6 +434,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API const char*   ImTextSkipLines(const char* in_text, const char* in_text_end, int lines_count, int* out_lines_skipped = NULL); // return beginning of line after skipping up to 'lines_count' lines. Fast path to coarse clip large text.
 
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
@@ -449,6 +458,12 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Time
+// - Dear ImGui only relies on io.DeltaTime: this monotonic clock is only used by profiling/debug tools.
+#if defined(IMGUI_ENABLE_PROFILER) || !defined(IMGUI_DISABLE_DEBUG_TOOLS)
+IMGUI_API ImU64             ImTimeGetNs();
+#endif
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -728,6 +743,54 @@ struct ImStableVector
     inline T*           push_back(const T& v)       { int i = Size; IM_ASSERT(i >= 0); if (Size == Capacity) reserve(Capacity + BLOCK_SIZE); void* ptr = &Blocks[i / BLOCK_SIZE][i % BLOCK_SIZE]; memcpy(ptr, &v, sizeof(v)); Size++; return (T*)ptr; }
 };
 
+// Helper: ImLinearAllocator
+// Bump pointer allocator for transient data. Allocations are never freed individually: Reset() rewinds the whole arena at once.
+// When the current block is exhausted, extra blocks are allocated with IM_ALLOC(). Those are released by the next Reset() which
+// grows the main block to fit the peak usage, so a repeating workload ends up not touching the heap at all.
+// Used by ImGuiContext::FrameArena, rewound by NewFrame(): see ImGui::FrameMemAlloc().
+struct ImLinearAllocator
+{
+    char*               Data = NULL;            // Main block
+    int                 Capacity = 0;           // Size of main block
+    int                 Offset = 0;             // Current offset in main block
+    int                 OverflowSize = 0;       // Total size of overflow blocks allocated since last Reset()
+    ImVector<void*>     OverflowBlocks;         // Extra blocks allocated since last Reset()
+    int                 AllocCount = 0;         // Number of Alloc() calls since last Reset()
+
+    inline ~ImLinearAllocator()                 { Clear(); }
+    inline void*        Alloc(size_t sz, int a = 16)
+    {
+        IM_ASSERT(a > 0 && (a & (a - 1)) == 0 && a <= 16);
+        AllocCount++;
+        const int off = IM_MEMALIGN(Offset, a);
+        if (off + (int)sz <= Capacity)
+        {
+            Offset = off + (int)sz;
+            return Data + off;
+        }
+        void* block = IM_ALLOC(sz > 0 ? sz : 1);
+        OverflowBlocks.push_back(block);
+        OverflowSize += IM_MEMALIGN((int)sz, 16);
+        return block;
+    }
+    inline void         Reset()
+    {
+        if (OverflowBlocks.Size > 0)
+        {
+            const int new_capacity = IM_MEMALIGN(Offset + OverflowSize + Capacity / 2, 1024);
+            for (void* block : OverflowBlocks)
+                IM_FREE(block);
+            OverflowBlocks.resize(0);
+            IM_FREE(Data);
+            Data = (char*)IM_ALLOC((size_t)new_capacity);
+            Capacity = new_capacity;
+        }
+        Offset = OverflowSize = AllocCount = 0;
+    }
+    inline void         Clear()                 { for (void* block : OverflowBlocks) IM_FREE(block); OverflowBlocks.clear(); IM_FREE(Data); Data = NULL; Capacity = Offset = OverflowSize = AllocCount = 0; }
+    inline int          GetUsedSize() const     { return Offset + OverflowSize; }
+};
+
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
@@ -1259,6 +1322,8 @@ enum ImGuiWindowRefreshFlags_
     ImGuiWindowRefreshFlags_TryToAvoidRefresh   = 1 << 0,   // [EXPERIMENTAL] Try to keep existing contents, USER MUST NOT HONOR BEGIN() RETURNING FALSE AND NOT APPEND.
     ImGuiWindowRefreshFlags_RefreshOnHover      = 1 << 1,   // [EXPERIMENTAL] Always refresh on hover
     ImGuiWindowRefreshFlags_RefreshOnFocus      = 1 << 2,   // [EXPERIMENTAL] Always refresh on focus
+    ImGuiWindowRefreshFlags_RefreshOnInput      = 1 << 3,   // Refresh on mouse inputs over the window, keyboard inputs while focused, and while one of its items is hovered or active (so hovering, navigation and tooltips keep working).
+    ImGuiWindowRefreshFlags_Retained            = ImGuiWindowRefreshFlags_TryToAvoidRefresh | ImGuiWindowRefreshFlags_RefreshOnInput, // Reuse contents until MarkWindowDirty() is called or inputs/state require a refresh. Begin() returns false when reusing contents.
     // Refresh policy/frequency, Load Balancing etc.
 };
 
@@ -1925,6 +1990,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImVector<ImDrawList*> MergedDrawLists;      // Pool of draw lists owned by the viewport, output of MergeDrawListsInDrawData() when io.ConfigDrawDataMergeDrawLists is set
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -1936,7 +2002,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImVec2              BuildWorkInsetMax;      // "
 
     ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); for (ImDrawList* draw_list : MergedDrawLists) IM_DELETE(draw_list); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& inset_min) const                           { return ImVec2(Pos.x + inset_min.x, Pos.y + inset_min.y); }
@@ -1949,6 +2015,32 @@ struct ImGuiViewportP : public ImGuiViewport
     ImRect  GetBuildWorkRect() const    { ImVec2 pos = CalcWorkRectPos(BuildWorkInsetMin); ImVec2 size = CalcWorkRectSize(BuildWorkInsetMin, BuildWorkInsetMax); return ImRect(pos.x, pos.y, pos.x + size.x, pos.y + size.y); }
 };
 
+// Uniform grid of hit-testable windows rectangles (OuterRectClipped + hover/resize padding), to accelerate FindHoveredWindowEx() and FindWindowsAtPos().
+// Built once per frame at the end of EndFrame(), after windows rectangles and display order are final: it reflects windows rectangles as of the end of last frame.
+// Each cell stores windows back to front. BringWindowToDisplayFront()/BringWindowToDisplayBack() only update the cells of the moved window.
+// Positions outside of Bounds and queries while the grid is invalidated fall back to a linear scan of g.WindowsActiveDisplayOrder[].
+struct ImGuiWindowHitGrid
+{
+    int                 FrameCount;         // Frame the grid was built on (-1: invalid, until next EndFrame())
+    ImRect              Bounds;             // Area covered by the grid (== main viewport rectangle)
+    ImVec2              CellSizeInv;        // 1.0f / cell size
+    int                 CellsX, CellsY;
+    ImVector<int>       CellsOffsets;       // [CellsX * CellsY + 1] Offset of each cell into Windows[]
+    ImVector<ImGuiWindow*> Windows;         // Windows, back to front for each cell
+
+    ImGuiWindowHitGrid()    { FrameCount = -1; CellsX = CellsY = 0; }
+    void        Invalidate()                { FrameCount = -1; }
+    ImGuiWindow* const* GetCell(const ImVec2& pos, int* out_count) const
+    {
+        if (FrameCount == -1 || !Bounds.Contains(pos)) { *out_count = 0; return NULL; }
+        const int cx = ImMin((int)((pos.x - Bounds.Min.x) * CellSizeInv.x), CellsX - 1);
+        const int cy = ImMin((int)((pos.y - Bounds.Min.y) * CellSizeInv.y), CellsY - 1);
+        const int cell_n = cy * CellsX + cx;
+        *out_count = CellsOffsets[cell_n + 1] - CellsOffsets[cell_n];
+        return Windows.Data + CellsOffsets[cell_n];
+    }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
@@ -2067,10 +2159,93 @@ struct ImGuiDebugAllocInfo
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+    int         FrameArenaAllocCount;       // Number of FrameMemAlloc() calls during last frame.
+    int         FrameArenaAllocSize;        // Total size of FrameMemAlloc() calls during last frame (including alignment padding).
+    int         FrameArenaOverflowCount;    // Number of frames where FrameMemAlloc() calls didn't fit in g.FrameArena and needed MemAlloc() calls.
+    bool        DebugBreakInAlloc;          // Set to break in next MemAlloc()/MemFree() call. Cleared once triggered.
 
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Per-window and per-table costs, displayed in Metrics/Debugger > Costs. Only recorded while g.DebugCostsEnabled is set.
+// - Window time is exclusive: time spent while a child window or popup is current is attributed to that other window.
+// - Table time is inclusive of nested tables and child windows, between BeginTable() and EndTable().
+// - Counters are attributed to the current window and the current table.
+struct ImGuiDebugCosts
+{
+    ImU64       TimeNs;                     // Time spent during current frame
+    int         ItemsCount;                 // Number of ItemAdd() calls during current frame (including clipped items)
+    int         TextBytes;                  // Number of bytes measured by CalcTextSize() during current frame
+    int         AllocCount;                 // Number of MemAlloc() calls during current frame
+    float       TimeAvg;                    // Moving averages, updated in EndFrame(). Time is in microseconds.
+    float       ItemsCountAvg;
+    float       TextBytesAvg;
+    float       AllocCountAvg;
+
+    ImGuiDebugCosts() { memset(this, 0, sizeof(*this)); }
+};
+
+// Hitch recorder, displayed in Metrics/Debugger > Hitches.
+// When the CPU time between NewFrame() and EndFrame() exceeds a threshold, record which expensive internal events happened during the frame.
+// Event times are inclusive: e.g. a texture repack caused by a texture grow caused by a glyph load is counted in all three.
+enum ImGuiDebugHitchEventType
+{
+    ImGuiDebugHitchEventType_GlyphLoad,         // ImFontBaked_BuildLoadGlyph(): first use of a glyph in a given font size
+    ImGuiDebugHitchEventType_TextureGrow,       // ImFontAtlasTextureGrow()
+    ImGuiDebugHitchEventType_TextureRepack,     // ImFontAtlasTextureRepack()
+    ImGuiDebugHitchEventType_IniSave,           // SaveIniSettingsToDisk() (including file write) or SaveIniSettingsToMemory()
+    ImGuiDebugHitchEventType_GcCompact,         // GcCompactTransientWindowBuffers(), TableGcCompactTransientBuffers()
+    ImGuiDebugHitchEventType_LargeAlloc,        // MemAlloc() calls >= LargeAllocThreshold
+    ImGuiDebugHitchEventType_COUNT
+};
+
+struct ImGuiDebugHitchEventStats
+{
+    int         Count;
+    ImU64       TotalTime;                  // Nanoseconds
+    ImU64       MaxTime;
+};
+
+struct ImGuiDebugHitchRecord
+{
+    int         FrameCount;
+    ImU64       FrameTime;                  // Nanoseconds between NewFrame() and end of Render(), + expensive events happening after Render()
+    ImGuiDebugHitchEventStats Events[ImGuiDebugHitchEventType_COUNT];
+};
+
+struct ImGuiDebugHitchRecorder
+{
+    bool        Enabled;                    // = true. Timing events costs two ImTimeGetNs() calls per event, which are rare.
+    float       ThresholdMs;                // = 50.0f. Frames taking longer are recorded.
+    size_t      LargeAllocThreshold;        // = 1 MB
+    int         RecordsCapacity;            // = 64. Size of ring buffer.
+    ImVector<ImGuiDebugHitchRecord> Records;// Ring buffer, allocated on first hitch.
+    int         RecordsWritten;             // Number of records written since last clear. Records[(RecordsWritten - 1) % Records.Size] is the latest.
+    ImU64       FrameTimeBegin;             // Time of current NewFrame()
+    ImU64       FrameTimeEnd;               // Time of end of current EndFrame()/Render(), 0 while within the frame
+    ImU64       FrameTimeAfterEnd;          // Time of outermost events happening after FrameTimeEnd, until next NewFrame() (e.g. SaveIniSettingsToDisk() called by application)
+    int         EventsDepth;                // Number of nested ImGuiDebugHitchEventScope
+    ImGuiDebugHitchEventStats FrameEvents[ImGuiDebugHitchEventType_COUNT]; // Events of current frame, from NewFrame() to next NewFrame()
+
+    ImGuiDebugHitchRecorder() { memset(this, 0, sizeof(*this)); Enabled = true; ThresholdMs = 50.0f; LargeAllocThreshold = 1024 * 1024; RecordsCapacity = 64; }
+};
+
+// Scoped event. Use the IMGUI_DEBUG_HITCH_EVENT() macro, which is compiled out with IMGUI_DISABLE_DEBUG_TOOLS.
+struct ImGuiDebugHitchEventScope
+{
+    ImGuiContext*               Ctx;        // NULL when not recording
+    ImGuiDebugHitchEventType    Type;
+    ImU64                       TimeBegin;
+    ImGuiDebugHitchEventScope(ImGuiDebugHitchEventType type);
+    ~ImGuiDebugHitchEventScope();
+};
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#define IMGUI_DEBUG_HITCH_EVENT(_TYPE)  ImGuiDebugHitchEventScope imgui_debug_hitch_event(_TYPE) // Once per scope
+#else
+#define IMGUI_DEBUG_HITCH_EVENT(_TYPE)  ((void)0)
+#endif
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2114,12 +2289,59 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+// Built-in profiler (compiled with IMGUI_ENABLE_PROFILER)
+// - Zones are recorded in a per-context ring buffer, viewable in Metrics/Debugger window > Profiler and exportable to Chrome trace format (chrome://tracing, ui.perfetto.dev).
+// - Add your own zones with IMGUI_PROFILER_ZONE("Name") at the beginning of a scope, or ProfilerZoneBegin()/ProfilerZoneEnd().
+// - Forward zones to an external profiler by registering ImGuiContextHookType_ProfilerZoneBegin/ProfilerZoneEnd hooks, and read ctx->Profiler.HookZone.
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerZone
+{
+    const char*             Name;               // Static string
+    ImGuiID                 ID;                 // Optional window/table ID, resolved to a name when displayed/exported
+    ImU64                   TimeBegin;          // ImTimeGetNs()
+    ImU64                   TimeEnd;            // 0 while the zone is open
+    int                     FrameCount;
+    int                     Depth;
+
+    ImGuiProfilerZone()     { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiProfiler
+{
+    bool                    Enabled;            // = true. Record zones.
+    int                     ZonesCapacity;      // = 65536. Size of ring buffer.
+    ImVector<ImGuiProfilerZone> Zones;          // Ring buffer, allocated on first use. Zones are stored in order of their beginning.
+    ImU64                   ZonesWritten;       // Sequence number of next zone. Zones[(ZonesWritten - 1) % Zones.Size] is the latest. Skipped forward by Zones.Size on clear.
+    ImU64                   ZonesStack[64];     // Sequence numbers of currently open zones.
+    int                     ZonesStackSize;     // May be larger than IM_ARRAYSIZE(ZonesStack) on unusually deep recursion, in which case inner zones are not recorded.
+    ImGuiProfilerZone*      HookZone;           // Zone being passed to ImGuiContextHookType_ProfilerZoneBegin/ProfilerZoneEnd hooks.
+
+    ImGuiProfiler()         { memset(this, 0, sizeof(*this)); Enabled = true; ZonesCapacity = 65536; }
+};
+
+// Scoped zone. Prefer using the IMGUI_PROFILER_ZONE() macros, which are compiled out without IMGUI_ENABLE_PROFILER.
+struct ImGuiProfilerZoneScope
+{
+    ImGuiContext*           Ctx;                // NULL when not recording
+    ImGuiProfilerZoneScope(const char* name, ImGuiID id = 0);
+    ~ImGuiProfilerZoneScope();
+};
+
+#define IMGUI_PROFILER_ZONE_CONCAT2(_A, _B)     _A##_B
+#define IMGUI_PROFILER_ZONE_CONCAT(_A, _B)      IMGUI_PROFILER_ZONE_CONCAT2(_A, _B)
+#define IMGUI_PROFILER_ZONE(_NAME)              ImGuiProfilerZoneScope IMGUI_PROFILER_ZONE_CONCAT(imgui_profiler_zone_, __LINE__)(_NAME)
+#define IMGUI_PROFILER_ZONE_ID(_NAME, _ID)      ImGuiProfilerZoneScope IMGUI_PROFILER_ZONE_CONCAT(imgui_profiler_zone_, __LINE__)(_NAME, _ID)
+#else
+#define IMGUI_PROFILER_ZONE(_NAME)              ((void)0)
+#define IMGUI_PROFILER_ZONE_ID(_NAME, _ID)      ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
 
 typedef void (*ImGuiContextHookCallback)(ImGuiContext* ctx, ImGuiContextHook* hook);
-enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_PendingRemoval_ };
+enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_ProfilerZoneBegin, ImGuiContextHookType_ProfilerZoneEnd, ImGuiContextHookType_PendingRemoval_ };
 
 struct ImGuiContextHook
 {
@@ -2143,6 +2365,8 @@ struct ImGuiContext
     ImGuiPlatformIO         PlatformIO;
     ImGuiStyle              Style;
     ImVector<ImFontAtlas*>  FontAtlases;                        // List of font atlases used by the context (generally only contains g.IO.Fonts aka the main font atlas)
+    bool                    FontAtlasesLockShared;              // [Multi-threading] Holding a shared lock on FontAtlases[] which have a LockFunc: during NewFrame()..EndFrame() and Render().
+    int                     FontAtlasesLockWriteDepth;          // [Multi-threading] Nesting of ImFontAtlasLockForWrite() calls from this context's thread.
     ImFont*                 Font;                               // Currently bound font. (== FontStack.back().Font)
     ImFontBaked*            FontBaked;                          // Currently bound font at currently bound size. (== Font->GetFontBaked(FontSize))
     float                   FontSize;                           // Currently bound font size == line height (== FontSizeBase + externals scales applied in the UpdateCurrentFontSize() function).
@@ -2173,10 +2397,17 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImGuiWindow*>  WindowsRecentlyActive;              // Windows active during the last frames or waiting for their buffers to be garbage collected. Per-frame bookkeeping in NewFrame() only iterates those.
+    ImVector<ImGuiWindow*>  WindowsActiveDisplayOrder;          // Windows active during last frame, sorted in display order, back to front (subset of Windows[], rebuilt by EndFrame()). May contain extra inactive windows: always check ->WasActive/->Active.
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index over WindowsActiveDisplayOrder[], rebuilt by EndFrame(). Must be invalidated or updated when the latter is modified.
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImPool<ImGuiWindowHibernateData> WindowsHibernated;         // State of windows destroyed by GcHibernateWindowList(), restored on their next Begin()
+    double                  WindowsHibernateNextTime;           // Next time GcHibernateWindows() will scan windows
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     float                   WindowsBorderHoverPadding;          // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, style.WindowBorderHoverPadding). This isn't so multi-dpi friendly.
+    ImGuiStyle              WindowsRefreshStyleBackup;          // Copy of Style when WindowsRefreshStyleHash was calculated, so windows using ImGuiWindowRefreshFlags_TryToAvoidRefresh only need a memcmp() to detect style changes.
+    ImGuiID                 WindowsRefreshStyleHash;
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -2367,13 +2598,11 @@ struct ImGuiContext
     ImVector<ImGuiTableTempData>    TablesTempData;             // Temporary table data (buffers reused/shared across instances, support nesting)
     ImPool<ImGuiTable>              Tables;                     // Persistent table data
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
-    ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
     ImPool<ImGuiTabBar>             TabBars;
     ImVector<ImGuiPtrOrIndex>       CurrentTabBarStack;
-    ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
     // Multi-Select state
     ImGuiBoxSelectState             BoxSelectState;
@@ -2495,6 +2724,13 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    bool                    DebugCostsEnabled;                  // Record per-window/per-table costs (see ImGuiDebugCosts)
+    ImGuiWindow*            DebugCostsWindow;                   // Window which time is currently being attributed to
+    ImU64                   DebugCostsLastTime;                 // Time of last change of DebugCostsWindow
+    ImGuiDebugHitchRecorder DebugHitchRecorder;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2508,7 +2744,9 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
+    float                   WakeupDelay;                        // Lowest delay requested via RequestWakeup() during the frame. Reset by NewFrame(), used by EndFrame() to calculate io.NextWakeupDelay.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImLinearAllocator       FrameArena;                         // Transient allocations, rewound by NewFrame(). Use FrameMemAlloc().
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
@@ -2599,6 +2837,7 @@ struct IMGUI_API ImGuiWindow
     ImGuiID                 MoveId;                             // == window->GetID("#MOVE")
     ImGuiID                 ChildId;                            // ID of corresponding item in parent window (for navigation to return from child window to parent window)
     ImGuiID                 PopupId;                            // ID in the popup stack when this window is used as a popup/menu (because we use generic Name/ID for recycling)
+    ImGuiID                 RefreshStateHash;                   // Hash of state previous contents depend on (style, font, atlas texture, position, size, scroll, focus). Used by ImGuiWindowRefreshFlags_TryToAvoidRefresh.
     ImVec2                  Scroll;
     ImVec2                  ScrollMax;
     ImVec2                  ScrollTarget;                       // target scroll position. stored as cursor position with scrolling canceled out, so the highest point is always 0.0f. (FLT_MAX for no change)
@@ -2615,6 +2854,7 @@ struct IMGUI_API ImGuiWindow
     bool                    WantCollapseToggle;
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
     bool                    SkipRefresh;                        // [EXPERIMENTAL] Reuse previous frame drawn contents, Begin() returns false.
+    bool                    RefreshDirty;                       // Set by MarkWindowDirty(), cleared on next refresh.
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
@@ -2654,6 +2894,9 @@ struct IMGUI_API ImGuiWindow
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
+    ImVec2ih                HitGridCellMin;                     // Cells of g.WindowsHitGrid overlapped by this window (valid when HitGridFrameCount == g.WindowsHitGrid.FrameCount)
+    ImVec2ih                HitGridCellMax;
+    int                     HitGridFrameCount;
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
@@ -2684,6 +2927,11 @@ struct IMGUI_API ImGuiWindow
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
+    bool                    MemoryHibernateBlocked;             // Set by GcHibernateWindows() when the window is still referenced by another window or by the context
+    bool                    MemoryHibernatePending;             // Set by GcHibernateWindowList() while unlinking the window, before destroying it
+    bool                    InRecentlyActiveList;               // Set when the window is in g.WindowsRecentlyActive[]
+    int                     WindowsIndex;                       // Index in g.Windows[] as of the last rebuild in EndFrame(). May be stale: only valid if g.Windows[WindowsIndex] == this.
+    ImGuiDebugCosts         DebugCosts;                         // Costs for Metrics/Debugger window (when g.DebugCostsEnabled is set)
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -2704,6 +2952,22 @@ public:
     //float     CalcFontSize() const    { ImGuiContext& g = *Ctx; return g.FontSizeBase * FontWindowScale * FontWindowScaleParents;
 };
 
+// Compact record of a window destroyed after being unused for io.ConfigMemoryHibernateTimer seconds.
+// Restored by CreateNewWindow() on the next Begin() call for this window.
+struct ImGuiWindowHibernateData
+{
+    ImGuiID                     ID;
+    ImVec2                      Pos;
+    ImVec2                      SizeFull;
+    ImVec2                      Scroll;
+    bool                        Collapsed;
+    ImGuiStorage                StateStorage;                   // Moved from ImGuiWindow (e.g. TreeNode open/close state)
+    ImVector<ImGuiOldColumns>   ColumnsStorage;                 // Moved from ImGuiWindow (legacy Columns() widths)
+
+    ImGuiWindowHibernateData()  { ID = 0; Collapsed = false; }
+    ~ImGuiWindowHibernateData() { ColumnsStorage.clear_destruct(); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Tab bar, Tab item support
 //-----------------------------------------------------------------------------
@@ -3004,6 +3268,7 @@ struct IMGUI_API ImGuiTable
     bool                        HasScrollbarYPrev;          // Whether ANY instance of this table had a vertical scrollbar during the previous.
     bool                        MemoryCompacted;
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
+    ImGuiDebugCosts             DebugCosts;                 // Costs for Metrics/Debugger window (when g.DebugCostsEnabled is set)
 
     ImGuiTable()                { memset(this, 0, sizeof(*this)); LastFrameActive = -1; }
     ~ImGuiTable()               { IM_FREE(RawData); }
@@ -3013,7 +3278,7 @@ struct IMGUI_API ImGuiTable
 // - Accessing those requires chasing an extra pointer so for very frequently used data we leave them in the main table structure.
 // - We also leave out of this structure data that tend to be particularly useful for debugging/metrics.
 // FIXME-TABLE: more transient data could be stored in a stacked ImGuiTableTempData: e.g. SortSpecs.
-// sizeof() ~ 136 bytes.
+// sizeof() ~ 144 bytes.
 struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
@@ -3032,6 +3297,7 @@ struct IMGUI_API ImGuiTableTempData
     ImVec1                      HostBackupColumnsOffset;    // Backup of OuterWindow->DC.ColumnsOffset at the end of BeginTable()
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
+    ImU64                       DebugCostsTimeBegin;        // Time of BeginTable() when g.DebugCostsEnabled is set, otherwise 0.
 
     ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
 };
@@ -3120,8 +3386,10 @@ namespace ImGui
     IMGUI_API int           FindWindowDisplayIndex(ImGuiWindow* window);
     IMGUI_API ImGuiWindow*  FindBottomMostVisibleWindowWithinBeginStack(ImGuiWindow* window);
 
-    // Windows: Idle, Refresh Policies [EXPERIMENTAL]
+    // Windows: Idle, Refresh Policies
     IMGUI_API void          SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags);
+    IMGUI_API void          MarkWindowDirty(ImGuiID window_id);     // Request a refresh of a window using ImGuiWindowRefreshFlags_TryToAvoidRefresh (and its parents) on its next Begin().
+    IMGUI_API void          MarkWindowDirty(const char* name);
 
     // Fonts, drawing
     IMGUI_API void          RegisterUserTexture(ImTextureData* tex); // Register external texture. EXPERIMENTAL: DO NOT USE YET.
@@ -3140,6 +3408,8 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API ImU64         CalcDrawDataFingerprint(ImDrawData* draw_data);           // Hash draw_data contents (io.ConfigDrawDataFingerprint). Return 0 when draw data uses user callbacks.
+    IMGUI_API void          MergeDrawListsInDrawData(ImDrawData* draw_data, ImVector<ImDrawList*>* merged_draw_lists); // Concatenate draw_data->CmdLists[] into draw lists taken from 'merged_draw_lists' pool (io.ConfigDrawDataMergeDrawLists)
 
     // Init
     IMGUI_API void          Initialize();
@@ -3149,6 +3419,8 @@ namespace ImGui
     IMGUI_API void          UpdateInputEvents(bool trickle_fast_inputs);
     IMGUI_API void          UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos);
     IMGUI_API void          FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window);
+    IMGUI_API int           FindWindowsAtPos(const ImVec2& pos, ImGuiWindow** out_windows, int out_windows_max);    // Find windows hit-testing 'pos' (ignoring popup/modal blocking), front to back. Return total number of windows found.
+    IMGUI_API void          UpdateWindowsHitGrid();
     IMGUI_API void          StartMouseMovingWindow(ImGuiWindow* window);
     IMGUI_API void          UpdateMouseMovingWindowNewFrame();
     IMGUI_API void          UpdateMouseMovingWindowEndFrame();
@@ -3614,10 +3886,17 @@ namespace ImGui
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
     IMGUI_API void          ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out);
 
+    // Transient memory
+    // - FrameMemAlloc(): allocate from g.FrameArena. Memory is valid until the next NewFrame() call and is never freed individually.
+    IMGUI_API void*         FrameMemAlloc(size_t size);
+    template<typename T> T* FrameMemAllocArray(int count)   { return (T*)FrameMemAlloc(sizeof(T) * (size_t)count); }
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcHibernateWindows(float hibernate_start_time);
+    IMGUI_API void          GcHibernateWindowList(const ImVector<ImGuiWindow*>& windows);
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
@@ -3662,9 +3941,24 @@ namespace ImGui
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
     IMGUI_API void          DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int windows_size, ImGuiWindow* parent_in_begin_stack);
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
+    IMGUI_API void          DebugNodeCosts();                   // Per-window/per-table costs, recorded when g.DebugCostsEnabled is set.
+    IMGUI_API void          DebugNodeHitches(ImGuiDebugHitchRecorder* recorder);
+    IMGUI_API void          DebugHitchesClear();
+    IMGUI_API void          DebugHitchesExport(ImGuiTextBuffer* out_buf);   // Human readable text, newest hitch last
+    IMGUI_API bool          DebugHitchesSave(const char* filename);
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Profiler (compiled with IMGUI_ENABLE_PROFILER)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfilerZoneBegin(const char* name, ImGuiID id = 0); // 'name' needs to be persistent (e.g. a string literal)
+    IMGUI_API void          ProfilerZoneEnd();
+    IMGUI_API void          ProfilerClear();
+    IMGUI_API void          ProfilerExportChromeTrace(ImGuiTextBuffer* out_buf);
+    IMGUI_API bool          ProfilerSaveChromeTrace(const char* filename);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     //inline void   SetItemUsingMouseWheel()                                            { SetItemKeyOwner(ImGuiKey_MouseWheelY); }      // Changed in 1.89
@@ -3853,6 +4147,9 @@ IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas,
 IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
 IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasLockContextShared(ImGuiContext* ctx, bool lock);
+IMGUI_API void              ImFontAtlasLockForWrite(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasUnlockForWrite(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
@@ -197,6 +197,7 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         // - From this point we will only compute the width of lines that are visible. Optimization only available when word-wrapping is disabled.
         // - We also don't vertically center the text within the line full height, which is unlikely to matter because we are likely the biggest and only item on the line.
         // - We use memchr(), pay attention that well optimized versions of those str/mem functions are much faster than a casually written loop.
+        // - When we don't need the width of clipped lines (ImGuiTextFlags_NoWidthForLargeClippedText), ImTextSkipLines() skips them without visiting each line.
         const char* line = text;
         const float line_height = GetTextLineHeight();
         ImVec2 text_size(0, 0);
@@ -209,6 +210,8 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
             if (lines_skippable > 0)
             {
                 int lines_skipped = 0;
+                if (flags & ImGuiTextFlags_NoWidthForLargeClippedText)
+                    line = ImTextSkipLines(line, text_end, lines_skippable, &lines_skipped);
                 while (line < text_end && lines_skipped < lines_skippable)
                 {
                     const char* line_end = (const char*)ImMemchr(line, '\n', text_end - line);
@@ -245,6 +248,8 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
 
             // Count remaining lines
             int lines_skipped = 0;
+            if (flags & ImGuiTextFlags_NoWidthForLargeClippedText)
+                line = ImTextSkipLines(line, text_end, INT_MAX, &lines_skipped);
             while (line < text_end)
             {
                 const char* line_end = (const char*)ImMemchr(line, '\n', text_end - line);
@@ -1786,6 +1791,8 @@ bool ImGui::SplitterBehavior(const ImRect& bb, ImGuiID id, ImGuiAxis axis, float
 
     if (held || (hovered && g.HoveredIdPreviousFrame == id && g.HoveredIdTimer >= hover_visibility_delay))
         SetMouseCursor(axis == ImGuiAxis_Y ? ImGuiMouseCursor_ResizeNS : ImGuiMouseCursor_ResizeEW);
+    else if (hovered)
+        RequestWakeup(hover_visibility_delay - g.HoveredIdTimer);
 
     ImRect bb_render = bb;
     if (held)
@@ -4600,6 +4607,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // We are only allowed to access the state if we are already the active widget.
     ImGuiInputTextState* state = GetInputTextState(id);
 
+    // Advance cursor blink timer before processing inputs, so a reset on this frame is not cut short by a large io.DeltaTime (e.g. first frame after the application waited for events)
+    if (state != NULL)
+        state->CursorAnim += io.DeltaTime;
+
     if (g.LastItemData.ItemFlags & ImGuiItemFlags_ReadOnly)
         flags |= ImGuiInputTextFlags_ReadOnly;
     const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
@@ -5389,8 +5400,13 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Draw blinking cursor
         if (render_cursor)
         {
-            state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+            {
+                // Request a frame when the cursor will next toggle visibility (+1 ms to be past the threshold despite rounding of accumulated time)
+                const float cursor_anim_phase = (state->CursorAnim <= 0.0f) ? state->CursorAnim : ImFmod(state->CursorAnim, 1.20f);
+                RequestWakeup(((cursor_anim_phase <= 0.80f) ? (0.80f - cursor_anim_phase) : (1.20f - cursor_anim_phase)) + 0.001f);
+            }
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -9136,6 +9152,8 @@ bool ImGui::BeginMenuEx(const char* label, const char* icon, bool enabled)
             want_open = true;
         else if (!menu_is_open && hovered && g.HoveredIdTimer >= 0.30f && g.MouseStationaryTimer >= 0.30f) // Hover to open (timer fallback)
             want_open = true;
+        else if (!menu_is_open && hovered)
+            RequestWakeup(0.30f - ImMin(g.HoveredIdTimer, g.MouseStationaryTimer));
         if (g.NavId == id && g.NavMoveDir == ImGuiDir_Right) // Nav-Right to open
         {
             want_open = want_open_nav_init = true;
@@ -9515,6 +9533,10 @@ void    ImGui::EndTabBar()
     if (tab_bar->WantLayout)
         TabBarLayout(tab_bar);
 
+    // New tabs, selection/reorder requests and scrolling animation need another frame
+    if (tab_bar->TabsAddedNew || tab_bar->NextSelectedTabId != 0 || tab_bar->ReorderRequestTabId != 0 || tab_bar->ScrollingAnim != tab_bar->ScrollingTarget)
+        RequestWakeup();
+
     // Restore the last visible height if no tab is visible, this reduce vertical flicker/movement when a tabs gets removed without calling SetTabItemClosed().
     const bool tab_bar_appearing = (tab_bar->PrevFrameVisible + 1 < g.FrameCount);
     if (tab_bar->VisibleTabWasSubmitted || tab_bar->VisibleTabId == 0 || tab_bar_appearing)
@@ -9624,7 +9646,7 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
     // Leading/Trailing tabs will be shrink only if central one aren't visible anymore, so layout the shrink data as: leading, trailing, central
     // (whereas our tabs are stored as: leading, central, trailing)
     int shrink_buffer_indexes[3] = { 0, sections[0].TabCount + sections[2].TabCount, sections[0].TabCount };
-    g.ShrinkWidthBuffer.resize(tab_bar->Tabs.Size);
+    ImGuiShrinkWidthItem* shrink_width_buffer = FrameMemAllocArray<ImGuiShrinkWidthItem>(tab_bar->Tabs.Size);
 
     // Compute ideal tabs widths + store them into shrink buffer
     ImGuiTabItem* most_recently_selected_tab = NULL;
@@ -9656,7 +9678,7 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
 
         // Store data so we can build an array sorted by width if we need to shrink tabs down
         IM_MSVC_WARNING_SUPPRESS(6385);
-        ImGuiShrinkWidthItem* shrink_width_item = &g.ShrinkWidthBuffer[shrink_buffer_indexes[section_n]++];
+        ImGuiShrinkWidthItem* shrink_width_item = &shrink_width_buffer[shrink_buffer_indexes[section_n]++];
         shrink_width_item->Index = tab_n;
         shrink_width_item->Width = shrink_width_item->InitialWidth = tab->ContentWidth;
         tab->Width = ImMax(tab->ContentWidth, 1.0f);
@@ -9693,13 +9715,13 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
     {
         int shrink_data_count = (central_section_is_visible ? sections[1].TabCount : sections[0].TabCount + sections[2].TabCount);
         int shrink_data_offset = (central_section_is_visible ? sections[0].TabCount + sections[2].TabCount : 0);
-        ShrinkWidths(g.ShrinkWidthBuffer.Data + shrink_data_offset, shrink_data_count, width_excess);
+        ShrinkWidths(shrink_width_buffer + shrink_data_offset, shrink_data_count, width_excess);
 
         // Apply shrunk values into tabs and sections
         for (int tab_n = shrink_data_offset; tab_n < shrink_data_offset + shrink_data_count; tab_n++)
         {
-            ImGuiTabItem* tab = &tab_bar->Tabs[g.ShrinkWidthBuffer[tab_n].Index];
-            float shrinked_width = IM_TRUNC(g.ShrinkWidthBuffer[tab_n].Width);
+            ImGuiTabItem* tab = &tab_bar->Tabs[shrink_width_buffer[tab_n].Index];
+            float shrinked_width = IM_TRUNC(shrink_width_buffer[tab_n].Width);
             if (shrinked_width < 0.0f)
                 continue;
 